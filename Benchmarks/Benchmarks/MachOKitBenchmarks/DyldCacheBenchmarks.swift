@@ -18,6 +18,26 @@ func registerDyldCacheBenchmarks() {
         blackHole(count)
     }
 
+    let processorCount = ProcessInfo.processInfo.activeProcessorCount
+    var concurrencies = Array(
+        sequence(first: 1, next: { $0 * 2 }).prefix(while: { $0 < processorCount })
+    )
+    concurrencies.append(processorCount)
+
+    for maxConcurrency in concurrencies {
+        Benchmark("DyldCache.machOFiles.concurrentForEach.\(maxConcurrency)") { benchmark in
+            guard let cache = BenchmarkFixtures.dyldCache() else { return }
+
+            benchmark.startMeasurement()
+
+            cache.concurrentForEachMachOFile(maxConcurrency: maxConcurrency) { machO in
+                machO.exportTrie?.forEachExportedSymbol { symbol, _ in
+                    blackHole(symbol)
+                }
+            }
+        }
+    }
+
     Benchmark("DyldCache.fileOffset.translate") { benchmark in
         guard let cache = BenchmarkFixtures.dyldCache() else { return }
         let addresses = BenchmarkFixtures.dyldCacheAddresses(from: cache, limit: 100_000)
@@ -78,4 +98,73 @@ func registerDyldCacheBenchmarks() {
             blackHole(cache.resolveOptionalRebase(at: fileOffset))
         }
     }
+
+    Benchmark("DyldCache.slidView.readPointer") { benchmark in
+        guard let cache = BenchmarkFixtures.dyldCache(),
+              let view = cache.slidView() else { return }
+        let addresses = BenchmarkFixtures.dyldCachePointerFileOffsets(from: cache, limit: 100_000)
+            .compactMap { cache.address(of: $0) }
+
+        benchmark.startMeasurement()
+
+        for address in addresses {
+            blackHole(view.readPointer(at: address))
+        }
+    }
+
+    Benchmark("DyldCache.rebases.mapping") { benchmark in
+        guard let cache = BenchmarkFixtures.dyldCache(),
+              let mappings = cache.mappingAndSlideInfos else { return }
+
+        benchmark.startMeasurement()
+
+        var count = 0
+        for mapping in mappings {
+            guard let rebases = cache.rebases(in: mapping) else { continue }
+            for rebase in rebases {
+                blackHole(rebase)
+                count += 1
+            }
+        }
+        blackHole(count)
+    }
+
+    Benchmark("DyldCache.objc.classHashTable.lookup") { benchmark in
+        guard let cache = BenchmarkFixtures.dyldCache(),
+              let objcOptimization = cache.objcOptimization,
+              let classes = objcOptimization.classHashTable(in: cache),
+              let objects = classes.objects(in: cache) else { return }
+        let names = objects.prefix(10_000).map(\.name)
+
+        benchmark.startMeasurement()
+
+        for name in names {
+            blackHole(classes.objects(named: name, in: cache))
+        }
+    }
+
+    Benchmark("DyldCache.swift.typeConformanceHashTable.lookup") { benchmark in
+        guard let cache = BenchmarkFixtures.dyldCache(),
+              let swiftOptimization = cache.swiftOptimization,
+              let table = swiftOptimization.typeConformanceHashTable(in: cache),
+              let conformances = table.conformances(in: cache) else { return }
+        let keys = conformances.prefix(10_000).compactMap { conformance -> (Int, Int)? in
+            guard case let .typeDescriptor(offset) = conformance.conformingType else {
+                return nil
+            }
+            return (offset, conformance.protocolOffset)
+        }
+
+        benchmark.startMeasurement()
+
+        for (typeOffset, protocolOffset) in keys {
+            blackHole(
+                table.conformances(
+                    conformingTypeOffset: typeOffset,
+                    protocolOffset: protocolOffset,
+                    in: cache
+                )
+            )
+        }
+    }
 }
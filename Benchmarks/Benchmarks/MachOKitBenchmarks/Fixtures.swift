@@ -54,6 +54,147 @@ enum BenchmarkFixtures {
         }
     }
 
+    /// Thin arm64e dylib whose `__DATA` segment is filled with chained fixups.
+    ///
+    /// Every slot of every page is a fixup with `DYLD_CHAINED_PTR_ARM64E`,
+    /// one in four being a bind to the only import.
+    static func syntheticChainedFixupsMachOFile() -> MachOFile {
+        do {
+            return try MachOFile(url: syntheticChainedFixupsMachOURL)
+        } catch {
+            fatalError("Failed to load synthetic Mach-O at \(syntheticChainedFixupsMachOURL.path): \(error)")
+        }
+    }
+
+    static let syntheticChainedFixupCount = 131_072
+
+    private static let syntheticChainedFixupsMachOURL: URL = {
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("MachOKitBenchmarks-arm64e-fixups-\(syntheticChainedFixupCount)")
+        do {
+            try makeSyntheticChainedFixupsMachO(
+                fixupCount: syntheticChainedFixupCount
+            ).write(to: url)
+        } catch {
+            fatalError("Failed to write synthetic Mach-O at \(url.path): \(error)")
+        }
+        return url
+    }()
+
+    private static func makeSyntheticChainedFixupsMachO(fixupCount: Int) -> Data {
+        let pageSize = 0x4000
+        let fixupsPerPage = pageSize / 8
+        let pageCount = (fixupCount + fixupsPerPage - 1) / fixupsPerPage
+
+        let textSize = pageSize
+        let dataOffset = textSize
+        let dataSize = pageCount * pageSize
+        let linkeditOffset = dataOffset + dataSize
+
+        var data = Data()
+        func append<T: FixedWidthInteger>(_ value: T) {
+            withUnsafeBytes(of: value.littleEndian) { data.append(contentsOf: $0) }
+        }
+        func appendName(_ name: String) {
+            var bytes = Array(name.utf8)
+            bytes += [UInt8](repeating: 0, count: 16 - bytes.count)
+            data.append(contentsOf: bytes)
+        }
+        func pad(to size: Int) {
+            data.append(contentsOf: [UInt8](repeating: 0, count: size - data.count))
+        }
+
+        // dyld_chained_fixups_header, dyld_chained_starts_in_image,
+        // dyld_chained_starts_in_segment, dyld_chained_import and symbol names
+        var fixups = Data()
+        func appendFixups<T: FixedWidthInteger>(_ value: T) {
+            withUnsafeBytes(of: value.littleEndian) { fixups.append(contentsOf: $0) }
+        }
+        let startsOffset = 32
+        let startsInSegmentOffset = 16
+        let startsInSegmentSize = 22 + 2 * pageCount
+        let importsOffset = (startsOffset + startsInSegmentOffset + startsInSegmentSize + 3) & ~3
+        let symbolsOffset = importsOffset + 4
+        let symbols = Array("\0_synthetic_import\0".utf8)
+
+        appendFixups(UInt32(0)) // fixups_version
+        appendFixups(UInt32(startsOffset))
+        appendFixups(UInt32(importsOffset))
+        appendFixups(UInt32(symbolsOffset))
+        appendFixups(UInt32(1)) // imports_count
+        appendFixups(UInt32(1)) // DYLD_CHAINED_IMPORT
+        appendFixups(UInt32(0)) // uncompressed symbols
+        appendFixups(UInt32(0)) // padding
+        appendFixups(UInt32(3)) // seg_count
+        appendFixups(UInt32(0)) // __TEXT
+        appendFixups(UInt32(startsInSegmentOffset)) // __DATA
+        appendFixups(UInt32(0)) // __LINKEDIT
+        appendFixups(UInt32(startsInSegmentSize))
+        appendFixups(UInt16(pageSize))
+        appendFixups(UInt16(1)) // DYLD_CHAINED_PTR_ARM64E
+        appendFixups(UInt64(dataOffset)) // segment_offset
+        appendFixups(UInt32(0)) // max_valid_pointer
+        appendFixups(UInt16(pageCount))
+        for _ in 0 ..< pageCount {
+            appendFixups(UInt16(0)) // chain starts at the top of each page
+        }
+        fixups.append(contentsOf: [UInt8](repeating: 0, count: importsOffset - fixups.count))
+        appendFixups(UInt32(1 | 1 << 9)) // lib_ordinal: 1, name_offset: 1
+        fixups.append(contentsOf: symbols)
+        let fixupsSize = fixups.count
+
+        // mach_header_64
+        append(UInt32(0xfeedfacf)) // MH_MAGIC_64
+        append(UInt32(0x0100000c)) // CPU_TYPE_ARM64
+        append(UInt32(2)) // CPU_SUBTYPE_ARM64E
+        append(UInt32(6)) // MH_DYLIB
+        append(UInt32(4)) // ncmds
+        append(UInt32(3 * 72 + 16)) // sizeofcmds
+        append(UInt32(0)) // flags
+        append(UInt32(0)) // reserved
+
+        // LC_SEGMENT_64 without sections
+        for (name, offset, size) in [
+            ("__TEXT", 0, textSize),
+            ("__DATA", dataOffset, dataSize),
+            ("__LINKEDIT", linkeditOffset, fixupsSize)
+        ] {
+            append(UInt32(0x19))
+            append(UInt32(72))
+            appendName(name)
+            append(UInt64(offset)) // vmaddr
+            append(UInt64((size + pageSize - 1) / pageSize * pageSize)) // vmsize
+            append(UInt64(offset)) // fileoff
+            append(UInt64(size)) // filesize
+            append(Int32(name == "__DATA" ? 3 : 1)) // maxprot
+            append(Int32(name == "__DATA" ? 3 : 1)) // initprot
+            append(UInt32(0)) // nsects
+            append(UInt32(0)) // flags
+        }
+
+        // LC_DYLD_CHAINED_FIXUPS
+        append(UInt32(0x80000034))
+        append(UInt32(16))
+        append(UInt32(linkeditOffset))
+        append(UInt32(fixupsSize))
+
+        pad(to: dataOffset)
+
+        // dyld_chained_ptr_arm64e_rebase / dyld_chained_ptr_arm64e_bind
+        for index in 0 ..< pageCount * fixupsPerPage {
+            let isLastInPage = index % fixupsPerPage == fixupsPerPage - 1
+            let next: UInt64 = isLastInPage ? 0 : 1
+            if index % 4 == 3 {
+                append(UInt64(0) | next << 51 | 1 << 62) // ordinal: 0
+            } else {
+                append(UInt64(index % fixupsPerPage * 8) | next << 51) // target in __TEXT
+            }
+        }
+
+        data.append(fixups)
+        return data
+    }
+
     static func classicRebases(from machO: MachOFile, benchmark: Benchmark) -> [Rebase]? {
         let rebases = machO.rebases
         guard !rebases.isEmpty else {
@@ -160,6 +301,19 @@ enum BenchmarkFixtures {
         }
     }
 
+    /// Synthetic crash-like addresses spread pseudo-randomly over the first mapping
+    static func dyldCacheRandomAddresses(from cache: some DyldCacheRepresentable, limit: Int) -> [UInt64] {
+        guard let mapping = cache.mappingInfos?.first,
+              mapping.size > 0 else {
+            return []
+        }
+        var state: UInt64 = 0x9E37_79B9_7F4A_7C15
+        return (0..<limit).map { _ in
+            state = state &* 6364136223846793005 &+ 1442695040888963407
+            return mapping.address + (state >> 11) % mapping.size
+        }
+    }
+
     static func dyldCacheFileOffsets(from cache: some DyldCacheRepresentable, limit: Int) -> [UInt64] {
         guard let mapping = cache.mappingInfos?.first,
               mapping.size > 0 else {
@@ -18,6 +18,39 @@ func registerFullDyldCacheBenchmarks() {
         blackHole(count)
     }
 
+    Benchmark("FullDyldCache.machOFile.installName") { benchmark in
+        guard let cache = BenchmarkFixtures.fullDyldCache() else { return }
+        let names = cache.dylibIndices.map(\.name)
+        guard let name = names.last else { return }
+        blackHole(cache.machOFile(forInstallName: name))
+        let iterations = 1_000
+
+        benchmark.startMeasurement()
+
+        for _ in 0..<iterations {
+            blackHole(cache.machOFile(forInstallName: name))
+        }
+    }
+
+    Benchmark("FullDyldCache.open") { benchmark in
+        guard let url = BenchmarkFixtures.fullDyldCacheURL else { return }
+
+        benchmark.startMeasurement()
+
+        blackHole(try? FullDyldCache(url: url))
+    }
+
+    Benchmark("LazyFullDyldCache.open.machOFile.installName") { benchmark in
+        guard let url = BenchmarkFixtures.fullDyldCacheURL,
+              let cache = BenchmarkFixtures.fullDyldCache(),
+              let name = cache.dylibIndices.map(\.name).last else { return }
+
+        benchmark.startMeasurement()
+
+        let lazyCache = try? LazyFullDyldCache(url: url)
+        blackHole(lazyCache?.machOFile(forInstallName: name))
+    }
+
     Benchmark("FullDyldCache.fileOffset.translate") { benchmark in
         guard let cache = BenchmarkFixtures.fullDyldCache() else { return }
         let addresses = BenchmarkFixtures.dyldCacheAddresses(from: cache, limit: 100_000)
@@ -92,6 +125,18 @@ func registerFullDyldCacheBenchmarks() {
         }
     }
 
+    Benchmark("FullDyldCache.symbolicate.batch") { benchmark in
+        guard let cache = BenchmarkFixtures.fullDyldCache(),
+              let symbolicator = try? cache.makeSymbolicator() else { return }
+        let addresses = BenchmarkFixtures.dyldCacheRandomAddresses(from: cache, limit: 100_000)
+        // index symbols of the images hit
+        blackHole(symbolicator.symbolicate(addresses))
+
+        benchmark.startMeasurement()
+
+        blackHole(symbolicator.symbolicate(addresses))
+    }
+
     Benchmark("FullDyldCache.resolveRebase") { benchmark in
         guard let cache = BenchmarkFixtures.fullDyldCache() else { return }
         let fileOffsets = BenchmarkFixtures.dyldCachePointerFileOffsets(from: cache, limit: 100_000)
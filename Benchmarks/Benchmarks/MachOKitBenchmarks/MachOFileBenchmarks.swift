@@ -32,6 +32,26 @@ func registerMachOFileBenchmarks() {
         blackHole(count)
     }
 
+    Benchmark("MachOFile.symbols.enumerate.borrowed") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+
+        benchmark.startMeasurement()
+
+        var count = 0
+        if machO.is64Bit, let symbols64 = machO.symbols64 {
+            for symbol in symbols64.borrowed {
+                blackHole(symbol)
+                count += 1
+            }
+        } else if let symbols32 = machO.symbols32 {
+            for symbol in symbols32.borrowed {
+                blackHole(symbol)
+                count += 1
+            }
+        }
+        blackHole(count)
+    }
+
     Benchmark("MachOFile.dependencies.repeated") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         let iterations = 1_000
@@ -54,6 +74,20 @@ func registerMachOFileBenchmarks() {
         }
     }
 
+    Benchmark("MachOFile.exportTrie.forEachExportedSymbol") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        guard let exportTrie = machO.exportTrie else { return }
+        let iterations = 100
+
+        benchmark.startMeasurement()
+
+        for _ in 0..<iterations {
+            exportTrie.forEachExportedSymbol { symbol, _ in
+                blackHole(symbol)
+            }
+        }
+    }
+
     Benchmark("MachOFile.exportTrie.search") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         guard let exportTrie = machO.exportTrie else { return }
@@ -67,6 +101,17 @@ func registerMachOFileBenchmarks() {
         }
     }
 
+    Benchmark("MachOFile.exportTrie.search.batch") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        guard let exportTrie = machO.exportTrie else { return }
+        let names = BenchmarkFixtures.exportedSymbolNames(from: machO, limit: 1_000).sorted()
+        guard !names.isEmpty else { return }
+
+        benchmark.startMeasurement()
+
+        blackHole(exportTrie.search(byKeys: names))
+    }
+
     Benchmark("MachOFile.exportTrie.prefixSearch") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         guard let exportTrie = machO.exportTrie else { return }
@@ -151,6 +196,27 @@ func registerMachOFileBenchmarks() {
         }
     }
 
+    Benchmark("MachOFile.closestSymbol.indexed") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let offsets = BenchmarkFixtures.symbolOffsets(from: machO, limit: 1_000)
+        guard let index = machO.symbolAddressIndex else { return }
+
+        benchmark.startMeasurement()
+
+        for offset in offsets {
+            blackHole(machO.closestSymbol(at: offset, using: index))
+        }
+    }
+
+    Benchmark("MachOFile.closestSymbols.batch") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let offsets = BenchmarkFixtures.symbolOffsets(from: machO, limit: 1_000)
+
+        benchmark.startMeasurement()
+
+        blackHole(machO.closestSymbols(forOffsets: offsets))
+    }
+
     Benchmark("MachOFile.symbols.named") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         let name = BenchmarkFixtures.symbolName(from: machO) ?? "__machokit_missing_symbol__"
@@ -164,6 +230,34 @@ func registerMachOFileBenchmarks() {
         }
     }
 
+    Benchmark("MachOFile.symbols.named.indexed") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let name = BenchmarkFixtures.symbolName(from: machO) ?? "__machokit_missing_symbol__"
+        guard let index = machO.symbolNameIndex else { return }
+        let iterations = 100
+
+        benchmark.startMeasurement()
+
+        for _ in 0..<iterations {
+            blackHole(machO.symbols(named: name, using: index))
+            blackHole(machO.symbol(named: name, using: index))
+        }
+    }
+
+    Benchmark("MachOFile.symbols.named.demangled.cached") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let name = BenchmarkFixtures.symbolName(from: machO) ?? "__machokit_missing_symbol__"
+        let cache = DemangledNameCache()
+        machO.demangleSymbolNames(into: cache)
+        let iterations = 100
+
+        benchmark.startMeasurement()
+
+        for _ in 0..<iterations {
+            blackHole(machO.symbols(named: name, mangled: false, using: cache))
+        }
+    }
+
     Benchmark("MachOFile.fileOffset.translate") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         let addresses = BenchmarkFixtures.machOAddresses(from: machO, limit: 100_000)
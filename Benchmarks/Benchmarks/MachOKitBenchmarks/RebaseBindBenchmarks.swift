@@ -229,6 +229,72 @@ func registerRebaseBindBenchmarks() {
         blackHole(count)
     }
 
+    Benchmark("MachOFile.dyldChainedFixups.forEachPointer") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let chainedFixups = machO.dyldChainedFixups
+
+        benchmark.startMeasurement()
+
+        var count = 0
+        chainedFixups?.forEachPointer(in: machO, filter: .bind) { pointer, _ in
+            blackHole(pointer)
+            count += 1
+        }
+        blackHole(count)
+    }
+
+    Benchmark("MachOFile.dyldChainedFixups.synthetic.pointers") { benchmark in
+        let machO = BenchmarkFixtures.syntheticChainedFixupsMachOFile()
+        let chainedFixups = machO.dyldChainedFixups
+        let startsInImage = chainedFixups?.startsInImage
+        let startsInSegments = chainedFixups?.startsInSegments(of: startsInImage) ?? []
+
+        benchmark.startMeasurement()
+
+        var count = 0
+        if let chainedFixups {
+            for segment in startsInSegments {
+                let pointers = chainedFixups.pointers(of: segment, in: machO)
+                count += pointers.count
+                blackHole(pointers)
+            }
+        }
+        precondition(count == BenchmarkFixtures.syntheticChainedFixupCount)
+        blackHole(count)
+    }
+
+    Benchmark("MachOFile.dyldChainedFixups.synthetic.concurrentPointers") { benchmark in
+        let machO = BenchmarkFixtures.syntheticChainedFixupsMachOFile()
+        let chainedFixups = machO.dyldChainedFixups
+
+        benchmark.startMeasurement()
+
+        let pointers = chainedFixups?.concurrentPointers(in: machO) ?? []
+        precondition(pointers.count == BenchmarkFixtures.syntheticChainedFixupCount)
+        blackHole(pointers)
+    }
+
+    Benchmark("MachOFile.mapImage.synthetic") { benchmark in
+        let machO = BenchmarkFixtures.syntheticChainedFixupsMachOFile()
+        guard let imageSize = machO.mappedImageSize else { return }
+        let buffer = UnsafeMutableRawBufferPointer.allocate(
+            byteCount: imageSize,
+            alignment: 0x4000
+        )
+        defer { buffer.deallocate() }
+
+        benchmark.startMeasurement()
+
+        do {
+            try machO.mapImage(into: buffer, baseAddress: 0x2_0000_0000) { _ in
+                0x7_0000_0000
+            }
+        } catch {
+            benchmark.error("Failed to map synthetic Mach-O: \(error)")
+        }
+        blackHole(buffer)
+    }
+
     Benchmark("MachOFile.dyldChainedFixups.pointerLookup") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         let chainedFixups = machO.dyldChainedFixups
@@ -244,6 +310,36 @@ func registerRebaseBindBenchmarks() {
         }
     }
 
+    Benchmark("MachOFile.dyldChainedFixups.fixupIndex") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let chainedFixups = machO.dyldChainedFixups
+        let startsInImage = chainedFixups?.startsInImage
+        let startsInSegments = chainedFixups?.startsInSegments(of: startsInImage) ?? []
+
+        benchmark.startMeasurement()
+
+        if let chainedFixups {
+            for segment in startsInSegments {
+                blackHole(chainedFixups.fixupIndex(of: segment, in: machO))
+            }
+        }
+    }
+
+    Benchmark("MachOFile.dyldChainedImportTable.bind") { benchmark in
+        let machO = BenchmarkFixtures.machOFile()
+        let binds = BenchmarkFixtures.chainedFixupPointers(from: machO, limit: 1_000)
+            .filter { $0.fixupInfo.bind != nil }
+        let table = machO.dyldChainedImportTable
+
+        benchmark.startMeasurement()
+
+        if let table {
+            for pointer in binds {
+                blackHole(table.bind(for: pointer))
+            }
+        }
+    }
+
     Benchmark("MachOFile.resolveRebase") { benchmark in
         let machO = BenchmarkFixtures.machOFile()
         let offsets = BenchmarkFixtures.chainedFixupPointers(from: machO, limit: 1_000)
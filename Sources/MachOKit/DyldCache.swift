@@ -37,13 +37,47 @@ public class DyldCache: DyldCacheRepresentable, _DyldCacheFileRepresentable {
     let _fileHandleIdentity: FileHandleIdentityBox
 
     // Retain the cache to which `self` belongs
-    internal var _fullCache: FullDyldCache?
+    private var _retainedFullCache: FullDyldCache?
+    // Full cache that owns `self` as a shared wrapper.
+    // Weak to avoid a reference cycle.
+    private weak var _ownerFullCache: FullDyldCache?
+    // Files of the owner, whose mappings `fileHandle` belongs to
+    private var _ownerFullCacheFiles: FullDyldCache.SharedFiles?
+
+    internal var _fullCache: FullDyldCache? {
+        get {
+            _lazyPropertiesLock.lock()
+            defer { _lazyPropertiesLock.unlock() }
+            if let fullCache = _retainedFullCache ?? _ownerFullCache {
+                return fullCache
+            }
+            // The owner has been released.
+            // Assemble it again from the same files, instead of reopening them.
+            guard let _ownerFullCacheFiles else { return nil }
+            let fullCache = FullDyldCache(sharedFiles: _ownerFullCacheFiles)
+            _retainedFullCache = fullCache
+            return fullCache
+        }
+        set {
+            _lazyPropertiesLock.lock()
+            defer { _lazyPropertiesLock.unlock() }
+            _retainedFullCache = newValue
+        }
+    }
     // Retain the main cache
     private var _mainCache: DyldCache?
     // Retain the symbol cache
-    internal var _symbolCache: DyldCache?
-    private var _mappingInfos: [DyldCacheMappingInfo]?
-    private var _mappingAndSlideInfos: [DyldCacheMappingAndSlideInfo]?
+    private var _symbolCache: DyldCache?
+    // Guards the lazily loaded properties above,
+    // since a cache is shared between threads by the concurrent drivers.
+    private let _lazyPropertiesLock = NSLock()
+    // Built on initialization and immutable,
+    // so address translation on multiple threads needs no lock.
+    private let _mappingTable: DyldCacheMappingTable<DyldCacheMappingInfo>?
+    private let _mappingAndSlideTable: DyldCacheMappingTable<DyldCacheMappingAndSlideInfo>?
+    private let _imageIndexStorage = DyldCacheImageIndex.Storage()
+    private var _localSymbolsEntryIndex: DyldCacheLocalSymbolsEntryIndex?
+    private let _localSymbolsEntryIndexLock = NSLock()
 
     public var headerSize: Int {
         header.actualSize
@@ -100,6 +134,15 @@ public class DyldCache: DyldCacheRepresentable, _DyldCacheFileRepresentable {
             typeRawValue: cpuType.rawValue,
             subtypeRawValue: cpuSubType.rawValue
         )
+
+        self._mappingTable = Self._loadMappingTable(
+            header: header,
+            in: fileHandle
+        )
+        self._mappingAndSlideTable = Self._loadMappingAndSlideTable(
+            header: header,
+            in: fileHandle
+        )
     }
 
     /// Load sub dyld cache
@@ -148,25 +191,64 @@ public class DyldCache: DyldCacheRepresentable, _DyldCacheFileRepresentable {
         self.cpu = cpu
         self._mainCache = mainCache
         self._mainCacheHeader = mainCache?.header ?? mainCacheHeader
+        self._mappingTable = Self._loadMappingTable(
+            header: self.header,
+            in: fileHandle
+        )
+        self._mappingAndSlideTable = Self._loadMappingAndSlideTable(
+            header: self.header,
+            in: fileHandle
+        )
+    }
+}
+
+extension DyldCache {
+    internal func _setOwnerFullCache(
+        _ fullCache: FullDyldCache,
+        sharedFiles: FullDyldCache.SharedFiles
+    ) {
+        _lazyPropertiesLock.lock()
+        defer { _lazyPropertiesLock.unlock() }
+        _ownerFullCache = fullCache
+        _ownerFullCacheFiles = sharedFiles
+    }
+
+    /// Read the lazily loaded property under the lock.
+    private func _cachedValue<T>(
+        _ keyPath: KeyPath<DyldCache, T?>
+    ) -> T? {
+        _lazyPropertiesLock.lock()
+        defer { _lazyPropertiesLock.unlock() }
+        return self[keyPath: keyPath]
+    }
+
+    /// Store the value loaded outside the lock,
+    /// unless another thread has stored one first.
+    /// - Returns: stored value
+    private func _storeCachedValue<T>(
+        _ value: T?,
+        at keyPath: ReferenceWritableKeyPath<DyldCache, T?>
+    ) -> T? {
+        _lazyPropertiesLock.lock()
+        defer { _lazyPropertiesLock.unlock() }
+        if let existing = self[keyPath: keyPath] { return existing }
+        self[keyPath: keyPath] = value
+        return value
     }
 }
 
 extension DyldCache {
     public var mainCache: DyldCache? {
-        if let _mainCache { return _mainCache }
+        if let mainCache = _cachedValue(\._mainCache) { return mainCache }
         if let _fullCache {
             if _fullCache.url == url { return self }
-            let mainCache = _fullCache.mainCache
-            _mainCache = mainCache
-            return mainCache
+            return _storeCachedValue(_fullCache.mainCache, at: \._mainCache)
         }
         if url.lastPathComponent.contains(".") {
             let url = url
                 .deletingPathExtension()
                 .deletingPathExtension()
-            _mainCache = try? .init(url: url)
-            _mainCache?._fullCache = _fullCache
-            return _mainCache
+            return _storeCachedValue(try? DyldCache(url: url), at: \._mainCache)
         } else {
             return self
         }
@@ -177,8 +259,15 @@ extension DyldCache {
         let url = url
             .deletingPathExtension()
             .deletingPathExtension()
-        _fullCache = try? .init(url: url)
-        return _fullCache
+        let fullCache = try? FullDyldCache(url: url)
+
+        _lazyPropertiesLock.lock()
+        defer { _lazyPropertiesLock.unlock() }
+        if let existing = _retainedFullCache ?? _ownerFullCache {
+            return existing
+        }
+        _retainedFullCache = fullCache
+        return fullCache
     }
 }
 
@@ -186,6 +275,8 @@ extension DyldCache {
     /// The cached `FullDyldCache`, if one is already associated with this cache.
     ///
     /// Unlike ``fullCache``, this property does not lazily create or load a full cache.
+    /// If this cache is a shared wrapper whose full cache has been released,
+    /// the full cache is assembled again from the files it retains, without reopening them.
     @_spi(Support)
     public var _cachedFullCache: FullDyldCache? {
         _fullCache
@@ -195,31 +286,12 @@ extension DyldCache {
 extension DyldCache {
     /// Sequence of mapping infos
     public var mappingInfos: [DyldCacheMappingInfo]? {
-        guard header.mappingCount > 0 else { return nil }
-        if let _mappingInfos { return _mappingInfos }
-        let mappingInfos: DataSequence<DyldCacheMappingInfo> = fileHandle.readDataSequence(
-            offset: numericCast(header.mappingOffset),
-            numberOfElements: numericCast(header.mappingCount)
-        )
-        let _mappingInfos = Array(mappingInfos)
-        self._mappingInfos = _mappingInfos
-        return _mappingInfos
+        _mappingTable?.mappings
     }
 
     /// Sequence of mapping and slide infos
     public var mappingAndSlideInfos: [DyldCacheMappingAndSlideInfo]? {
-        guard header.mappingWithSlideCount > 0,
-              header.hasProperty(\.mappingWithSlideCount) else {
-            return nil
-        }
-        if let _mappingAndSlideInfos { return _mappingAndSlideInfos }
-        let mappingAndSlideInfos: DataSequence<DyldCacheMappingAndSlideInfo> = fileHandle.readDataSequence(
-            offset: numericCast(header.mappingWithSlideOffset),
-            numberOfElements: numericCast(header.mappingWithSlideCount)
-        )
-        let _mappingAndSlideInfos = Array(mappingAndSlideInfos)
-        self._mappingAndSlideInfos = _mappingAndSlideInfos
-        return _mappingAndSlideInfos
+        _mappingAndSlideTable?.mappings
     }
 
     /// Sequence of image infos.
@@ -275,7 +347,7 @@ extension DyldCache {
     /// DyldCache containing unmapped local symbols
     public var symbolCache: DyldCache? {
         get throws {
-            if let _symbolCache { return _symbolCache }
+            if let symbolCache = _cachedValue(\._symbolCache) { return symbolCache }
             guard header.hasProperty(\.symbolFileUUID),
                   header.symbolFileUUID != .zero else {
                 return nil
@@ -286,8 +358,7 @@ extension DyldCache {
                 subcacheUrl: .init(fileURLWithPath: path, isDirectory: false),
                 mainCacheHeader: mainCacheHeader
             )
-            _symbolCache = symbolCache
-            return symbolCache
+            return _storeCachedValue(symbolCache, at: \._symbolCache)
         }
     }
 
@@ -307,6 +378,117 @@ extension DyldCache {
     }
 }
 
+extension DyldCache {
+    /// Index of local symbols entries by dylib offset
+    ///
+    /// It is built on first access and reused by
+    /// the `entry(for:in:)` lookups of ``DyldCacheLocalSymbolsInfo`` on this cache.
+    public var localSymbolsEntryIndex: DyldCacheLocalSymbolsEntryIndex? {
+        _localSymbolsEntryIndexLock.lock()
+        defer { _localSymbolsEntryIndexLock.unlock() }
+
+        if let _localSymbolsEntryIndex { return _localSymbolsEntryIndex }
+        guard let localSymbolsInfo else { return nil }
+        let index = DyldCacheLocalSymbolsEntryIndex(
+            info: localSymbolsInfo,
+            in: self
+        )
+        _localSymbolsEntryIndex = index
+        return index
+    }
+
+    /// Local symbols of all images contained in this cache.
+    ///
+    /// Local symbols are read from this cache if it has them, otherwise from ``symbolCache``.
+    /// Each entry is found with ``localSymbolsEntryIndex``, so the symbol table and
+    /// the entries are only read once, and no ``MachOFile`` is created.
+    /// - Returns: Local symbols of images that have an entry, in image order
+    public func imageLocalSymbols() throws -> [DyldCacheImageLocalSymbols] {
+        let symbolsCache: DyldCache
+        if localSymbolsInfo != nil {
+            symbolsCache = self
+        } else if let symbolCache = try symbolCache {
+            symbolsCache = symbolCache
+        } else {
+            return []
+        }
+        guard let info = symbolsCache.localSymbolsInfo,
+              let index = symbolsCache.localSymbolsEntryIndex else {
+            return []
+        }
+
+        let effectiveDyldCache = mainCache ?? self
+        guard let imageInfos = effectiveDyldCache.imageInfos else {
+            return []
+        }
+        let images = imageInfos.lazy.compactMap { info -> (imagePath: String, address: UInt64, headerOffset: UInt64)? in
+            guard let fileOffset = self.fileOffset(of: info.address),
+                  let imagePath = info.path(in: effectiveDyldCache) else {
+                return nil
+            }
+            return (imagePath, info.address, fileOffset)
+        }
+
+        return info._imageLocalSymbols(
+            for: images,
+            in: symbolsCache,
+            using: index,
+            sharedRegionStart: mainCacheHeader.sharedRegionStart
+        )
+    }
+}
+
+extension DyldCache {
+    private static func _loadMappingTable(
+        header: DyldCacheHeader,
+        in fileHandle: File
+    ) -> DyldCacheMappingTable<DyldCacheMappingInfo>? {
+        guard header.mappingCount > 0 else { return nil }
+        let mappingInfos: DataSequence<DyldCacheMappingInfo> = fileHandle.readDataSequence(
+            offset: numericCast(header.mappingOffset),
+            numberOfElements: numericCast(header.mappingCount)
+        )
+        return .init(mappingInfos)
+    }
+
+    private static func _loadMappingAndSlideTable(
+        header: DyldCacheHeader,
+        in fileHandle: File
+    ) -> DyldCacheMappingTable<DyldCacheMappingAndSlideInfo>? {
+        guard header.mappingWithSlideCount > 0,
+              header.hasProperty(\.mappingWithSlideCount) else {
+            return nil
+        }
+        let mappingAndSlideInfos: DataSequence<DyldCacheMappingAndSlideInfo> = fileHandle.readDataSequence(
+            offset: numericCast(header.mappingWithSlideOffset),
+            numberOfElements: numericCast(header.mappingWithSlideCount)
+        )
+        return .init(mappingAndSlideInfos)
+    }
+
+    public func mappingInfo(for address: UInt64) -> DyldCacheMappingInfo? {
+        _mappingTable?.mapping(containingAddress: address)
+    }
+
+    public func mappingInfo(
+        forFileOffset offset: UInt64
+    ) -> DyldCacheMappingInfo? {
+        _mappingTable?.mapping(containingFileOffset: offset)
+    }
+
+    public func mappingAndSlideInfo(
+        for address: UInt64
+    ) -> DyldCacheMappingAndSlideInfo? {
+        _mappingAndSlideTable?.mapping(containingAddress: address)
+    }
+
+    public func mappingAndSlideInfo(
+        forFileOffset offset: UInt64
+    ) -> DyldCacheMappingAndSlideInfo? {
+        _mappingAndSlideTable?.mapping(containingFileOffset: offset)
+    }
+}
+
 extension DyldCache {
     /// Sequence of MachO information contained in this cache
     public func machOFiles() -> AnySequence<MachOFile> {
@@ -351,6 +533,56 @@ extension DyldCache {
         return AnySequence(machOFiles)
     }
 
+    /// Get image info with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: image info
+    public func imageInfo(
+        forInstallName installName: String
+    ) -> DyldCacheImageInfo? {
+        imageIndex?.imageInfo(forInstallName: installName)
+    }
+
+    /// Get MachO with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// Unlike searching ``machOFiles()``, other images are not read.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: MachO file
+    ///
+    /// If this cache is a subcache, nil is returned for images that exist in other caches.
+    public func machOFile(
+        forInstallName installName: String
+    ) -> MachOFile? {
+        let effectiveDyldCache = mainCache ?? self
+        guard let info = imageInfo(forInstallName: installName),
+              let fileOffset = self.fileOffset(of: info.address),
+              let imagePath = info.path(in: effectiveDyldCache) else {
+            return nil
+        }
+        return try? MachOFile(
+            url: self.url,
+            imagePath: imagePath,
+            headerStartOffsetInCache: numericCast(fileOffset),
+            cache: self
+        )
+    }
+
+    private var imageIndex: DyldCacheImageIndex? {
+        if let mainCache, mainCache !== self {
+            return mainCache.imageIndex
+        }
+        return _imageIndexStorage.index {
+            guard let imageInfos else { return nil }
+            return .init(
+                imageInfos: Array(imageInfos),
+                dylibIndices: dylibIndices,
+                path: { $0.path(in: self) }
+            )
+        }
+    }
+
     public var dyld: MachOFile? {
         guard let offset = fileOffset(of: mainCacheHeader.dyldInCacheMH) else {
             return nil
@@ -364,6 +596,104 @@ extension DyldCache {
     }
 }
 
+extension DyldCache {
+    /// Call `body` for every MachO contained in this cache, on multiple threads.
+    ///
+    /// Images are spread across workers with work stealing,
+    /// so a few large images do not leave other workers idle.
+    /// `body` is called in no particular order.
+    ///
+    /// Mapping information is read when the cache is created,
+    /// and other lazily loaded properties are loaded under a lock,
+    /// so the cache can be shared by `body` calls without loading anything beforehand.
+    /// Each MachO is only passed to one call.
+    /// - Parameters:
+    ///   - maxConcurrency: Maximum number of images processed concurrently.
+    ///   - body: Called from multiple threads.
+    public func concurrentForEachMachOFile(
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        _ body: (MachOFile) -> Void
+    ) {
+        _concurrentForEachMachOFile(
+            at: _machOFileLocations(),
+            maxConcurrency: maxConcurrency
+        ) { _, machO in
+            body(machO)
+        }
+    }
+
+    /// Transform every MachO contained in this cache, on multiple threads.
+    ///
+    /// Results are in the order of ``imageInfos``, regardless of scheduling,
+    /// so the result at an index belongs to the image info at the same index.
+    /// - Parameters:
+    ///   - maxConcurrency: Maximum number of images processed concurrently.
+    ///   - transform: Called from multiple threads.
+    /// - Returns: Transformed values in image order.
+    ///   `nil` for images that cannot be loaded.
+    public func concurrentMapMachOFiles<T>(
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        _ transform: (MachOFile) -> T
+    ) -> [T?] {
+        let locations = _machOFileLocations()
+        var results = [T?](repeating: nil, count: locations.count)
+        results.withUnsafeMutableBufferPointer { results in
+            _concurrentForEachMachOFile(
+                at: locations,
+                maxConcurrency: maxConcurrency
+            ) { index, machO in
+                results[index] = transform(machO)
+            }
+        }
+        return results
+    }
+
+    private func _concurrentForEachMachOFile(
+        at locations: [(imagePath: String, fileOffset: UInt64)?],
+        maxConcurrency: Int,
+        _ body: (Int, MachOFile) -> Void
+    ) {
+        WorkStealingScheduler.run(
+            count: locations.count,
+            maxConcurrency: maxConcurrency
+        ) { index in
+            guard let location = locations[index] else { return }
+            guard let machO = try? MachOFile(
+                url: self.url,
+                imagePath: location.imagePath,
+                headerStartOffsetInCache: numericCast(location.fileOffset),
+                cache: self
+            ) else { return }
+            body(index, machO)
+        }
+    }
+
+    /// Paths and file offsets of the images in this cache, in image order.
+    /// `nil` for images whose path or file offset is not found.
+    private func _machOFileLocations() -> [(imagePath: String, fileOffset: UInt64)?] {
+        let effectiveDyldCache: DyldCache
+        let imageInfos: DataSequence<DyldCacheImageInfo>
+
+        if let mainCache, let mainCacheImageInfos = mainCache.imageInfos {
+            effectiveDyldCache = mainCache
+            imageInfos = mainCacheImageInfos
+        } else if let currentCacheImageInfos = self.imageInfos {
+            effectiveDyldCache = self
+            imageInfos = currentCacheImageInfos
+        } else {
+            return []
+        }
+
+        return imageInfos.map { info in
+            guard let fileOffset = self.fileOffset(of: info.address),
+                  let imagePath = info.path(in: effectiveDyldCache) else {
+                return nil
+            }
+            return (imagePath, fileOffset)
+        }
+    }
+}
+
 extension DyldCache {
     public var codeSign: MachOFile.CodeSign? {
         .init(
@@ -395,3 +725,31 @@ extension DyldCache {
         _resolveRebase(at: offset, skipsZeroValue: true)
     }
 }
+
+extension DyldCache {
+    /// Rebases in the specified mapping, decoded page by page from its slide info.
+    ///
+    /// Each page is decoded by walking its delta chains once,
+    /// so resolving all pointers in a mapping is a single pass.
+    /// Targets are the same values as ``resolveRebase(at:)`` returns for each pointer.
+    /// - Parameter mapping: mapping with slide info
+    /// - Returns: rebases of all pages, or `nil` if the mapping has no slide info
+    public func rebases(
+        in mapping: DyldCacheMappingAndSlideInfo
+    ) -> DyldCacheSlideRebases? {
+        _rebases(in: mapping)
+    }
+
+    /// Read-only view of the cache memory after sliding, with pages materialized on demand.
+    /// - Parameters:
+    ///   - slide: slide added to the targets of rebased pointers
+    ///   - maxPageCount: maximum number of 16KB pages kept in memory
+    /// - Returns: slid view of the mappings,
+    ///   or `nil` if the cache has no slide info in its mappings or it cannot be decoded
+    public func slidView(
+        slide: UInt64 = 0,
+        maxPageCount: Int = 1024
+    ) -> DyldCacheSlidView? {
+        _slidView(slide: slide, maxPageCount: maxPageCount)
+    }
+}
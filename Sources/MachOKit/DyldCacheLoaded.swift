@@ -53,6 +53,10 @@ public struct DyldCacheLoaded: DyldCacheRepresentable {
 
     private var _mainCacheHeader: DyldCacheHeader?
 
+    private var _mappingTable: DyldCacheMappingTable<DyldCacheMappingInfo>?
+    private var _mappingAndSlideTable: DyldCacheMappingTable<DyldCacheMappingAndSlideInfo>?
+    private let _imageIndexStorage = DyldCacheImageIndex.Storage()
+
     /// Header for main dyld cache
     /// When this dyld cache is a subcache, represent the header of the main cache
     ///
@@ -90,6 +94,13 @@ public struct DyldCacheLoaded: DyldCacheRepresentable {
             typeRawValue: cpuType.rawValue,
             subtypeRawValue: cpuSubType.rawValue
         )
+
+        if let mappingInfos {
+            self._mappingTable = .init(mappingInfos)
+        }
+        if let mappingAndSlideInfos {
+            self._mappingAndSlideTable = .init(mappingAndSlideInfos)
+        }
     }
 
     /// Load sub dyld cache
@@ -194,6 +205,30 @@ extension DyldCacheLoaded {
     }
 }
 
+extension DyldCacheLoaded {
+    public func mappingInfo(for address: UInt64) -> DyldCacheMappingInfo? {
+        _mappingTable?.mapping(containingAddress: address)
+    }
+
+    public func mappingInfo(
+        forFileOffset offset: UInt64
+    ) -> DyldCacheMappingInfo? {
+        _mappingTable?.mapping(containingFileOffset: offset)
+    }
+
+    public func mappingAndSlideInfo(
+        for address: UInt64
+    ) -> DyldCacheMappingAndSlideInfo? {
+        _mappingAndSlideTable?.mapping(containingAddress: address)
+    }
+
+    public func mappingAndSlideInfo(
+        forFileOffset offset: UInt64
+    ) -> DyldCacheMappingAndSlideInfo? {
+        _mappingAndSlideTable?.mapping(containingFileOffset: offset)
+    }
+}
+
 extension DyldCacheLoaded {
     /// Sequence of MachO information contained in this cache
     public func machOImages() -> AnySequence<MachOImage> {
@@ -215,6 +250,47 @@ extension DyldCacheLoaded {
         return AnySequence(machOFiles)
     }
 
+    /// Get image info with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: image info
+    public func imageInfo(
+        forInstallName installName: String
+    ) -> DyldCacheImageInfo? {
+        imageIndex?.imageInfo(forInstallName: installName)
+    }
+
+    /// Get MachO image with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// Unlike searching ``machOImages()``, other images are not read.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: MachO image
+    public func machOImage(
+        forInstallName installName: String
+    ) -> MachOImage? {
+        guard let slide,
+              let info = imageInfo(forInstallName: installName),
+              let ptr = UnsafeRawPointer(bitPattern: Int(info.address) + slide) else {
+            return nil
+        }
+        return MachOImage(
+            ptr: ptr.assumingMemoryBound(to: mach_header.self)
+        )
+    }
+
+    private var imageIndex: DyldCacheImageIndex? {
+        _imageIndexStorage.index {
+            guard let imageInfos else { return nil }
+            return .init(
+                imageInfos: Array(imageInfos),
+                dylibIndices: dylibIndices,
+                path: { $0.path(in: self) }
+            )
+        }
+    }
+
     public var dyld: MachOImage? {
         guard let slide,
               let ptr = UnsafeRawPointer(bitPattern: Int(header.dyldInCacheMH) + slide) else {
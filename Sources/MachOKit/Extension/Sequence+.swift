@@ -7,6 +7,7 @@
 //
 
 import Foundation
+import MachOKitC
 
 extension Sequence {
     func element(at index: Int) -> Element? {
@@ -29,6 +30,7 @@ extension Sequence<BindOperation> {
         is64Bit: Bool
     ) -> [BindingSymbol] {
         var symbolName = "??"
+        var isWeakImport = false
         var libraryOrdinal: Int = 0
         var bindType: BindType = .pointer
         var addend: Int = 0
@@ -57,8 +59,9 @@ extension Sequence<BindOperation> {
             case let .set_dylib_special_imm(special: special):
                 libraryOrdinal = Int(special.rawValue)
 
-            case let .set_symbol_trailing_flags_imm(flags: _, symbol: symbol):
+            case let .set_symbol_trailing_flags_imm(flags: flags, symbol: symbol):
                 symbolName = symbol
+                isWeakImport = flags & UInt(BIND_SYMBOL_FLAGS_WEAK_IMPORT) != 0
 
             case let .set_type_imm(type: type):
                 bindType = type
@@ -81,7 +84,8 @@ extension Sequence<BindOperation> {
                         segmentIndex: segmentIndex,
                         segmentOffset: segmentOffset,
                         addend: addend,
-                        symbolName: symbolName
+                        symbolName: symbolName,
+                        isWeakImport: isWeakImport
                     )
                 )
                 segmentOffset &+= UInt(ptrSize)
@@ -94,7 +98,8 @@ extension Sequence<BindOperation> {
                         segmentIndex: segmentIndex,
                         segmentOffset: segmentOffset,
                         addend: addend,
-                        symbolName: symbolName
+                        symbolName: symbolName,
+                        isWeakImport: isWeakImport
                     )
                 )
                 segmentOffset &+= UInt(ptrSize)
@@ -108,7 +113,8 @@ extension Sequence<BindOperation> {
                         segmentIndex: segmentIndex,
                         segmentOffset: segmentOffset,
                         addend: addend,
-                        symbolName: symbolName
+                        symbolName: symbolName,
+                        isWeakImport: isWeakImport
                     )
                 )
                 segmentOffset &+= (scale + 1) * UInt(ptrSize)
@@ -122,7 +128,8 @@ extension Sequence<BindOperation> {
                             segmentIndex: segmentIndex,
                             segmentOffset: segmentOffset,
                             addend: addend,
-                            symbolName: symbolName
+                            symbolName: symbolName,
+                            isWeakImport: isWeakImport
                         )
                     )
                     segmentOffset &+= skip + UInt(ptrSize)
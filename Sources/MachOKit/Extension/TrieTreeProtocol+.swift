@@ -10,18 +10,27 @@ import Foundation
 
 extension TrieTreeProtocol where Content == ExportTrieNodeContent {
     public var exportedSymbols: [ExportedSymbol] {
-        guard let root = first(where: { _ in true }) else {
-            return []
+        var result: [ExportedSymbol] = []
+        forEachExportedSymbol { symbol, _ in
+            result.append(symbol)
         }
-        var result: [(String, Content)] = []
-        _recurseTrie(currentName: "", entry: root, result: &result)
         return result
-            .map {
-                name, content in
-                let symbolOffset: Int? = if let symbolOffset = content.symbolOffset {
-                    .init(bitPattern: symbolOffset)
-                } else { nil }
-                return .init(
+    }
+
+    /// Visits all exported symbols one at a time.
+    ///
+    /// Unlike ``exportedSymbols``, no intermediate array is created,
+    /// and the traversal can be ended early by setting `stop` to true.
+    /// - Parameter body: Closure called with each exported symbol.
+    public func forEachExportedSymbol(
+        _ body: (_ symbol: ExportedSymbol, _ stop: inout Bool) throws -> Void
+    ) rethrows {
+        try forEachTerminal { name, _, content, stop in
+            let symbolOffset: Int? = if let symbolOffset = content.symbolOffset {
+                .init(bitPattern: symbolOffset)
+            } else { nil }
+            try body(
+                .init(
                     name: name,
                     offset: symbolOffset,
                     flags: content.flags ?? [],
@@ -30,8 +39,10 @@ extension TrieTreeProtocol where Content == ExportTrieNodeContent {
                     stub: content.stub,
                     resolverOffset: content.resolver,
                     functionVariantTableIndex: content.functionVariantTableIndex
-                )
-            }
+                ),
+                &stop
+            )
+        }
     }
 
     public func search(by key: String) -> ExportedSymbol? {
@@ -54,6 +65,28 @@ extension TrieTreeProtocol where Content == ExportTrieNodeContent {
         )
     }
 
+    public func search(byKeys keys: [String]) -> [ExportedSymbol?] {
+        zip(keys, _search(byKeys: keys)).map { key, found in
+            guard let (_, content) = found else {
+                return nil
+            }
+            let symbolOffset: Int? = if let symbolOffset = content.symbolOffset {
+                .init(bitPattern: symbolOffset)
+            } else { nil }
+
+            return .init(
+                name: key,
+                offset: symbolOffset,
+                flags: content.flags ?? [],
+                ordinal: content.ordinal,
+                importedName: content.importedName,
+                stub: content.stub,
+                resolverOffset: content.resolver,
+                functionVariantTableIndex: content.functionVariantTableIndex
+            )
+        }
+    }
+
     public func search(byKeyPrefix prefix: String) -> [ExportedSymbol] {
         let found = _search(byKeyPrefix: prefix)
         return found.compactMap {
@@ -78,14 +111,11 @@ extension TrieTreeProtocol where Content == ExportTrieNodeContent {
 
 extension TrieTreeProtocol where Content == DylibsTrieNodeContent {
     public var dylibIndices: [DylibIndex] {
-        guard let root = first(where: { _ in true }) else {
-            return []
-        }
-        var result: [(String, Content)] = []
-        _recurseTrie(currentName: "", entry: root, result: &result)
-        return result.map {
-            .init(name: $0, index: $1.index)
+        var result: [DylibIndex] = []
+        forEachTerminal { name, _, content, _ in
+            result.append(.init(name: name, index: content.index))
         }
+        return result
     }
 
     public func search(by key: String) -> DylibIndex? {
@@ -95,6 +125,15 @@ extension TrieTreeProtocol where Content == DylibsTrieNodeContent {
         return.init(name: key, index: content.index)
     }
 
+    public func search(byKeys keys: [String]) -> [DylibIndex?] {
+        zip(keys, _search(byKeys: keys)).map { key, found in
+            guard let (_, content) = found else {
+                return nil
+            }
+            return .init(name: key, index: content.index)
+        }
+    }
+
     public func search(byKeyPrefix prefix: String) -> [DylibIndex] {
         let found = _search(byKeyPrefix: prefix)
         return found.compactMap {
@@ -105,14 +144,11 @@ extension TrieTreeProtocol where Content == DylibsTrieNodeContent {
 
 extension TrieTreeProtocol where Content == ProgramsTrieNodeContent {
     public var programOffsets: [ProgramOffset] {
-        guard let root = first(where: { _ in true }) else {
-            return []
-        }
-        var result: [(String, Content)] = []
-        _recurseTrie(currentName: "", entry: root, result: &result)
-        return result.map {
-            .init(name: $0, offset: $1.offset)
+        var result: [ProgramOffset] = []
+        forEachTerminal { name, _, content, _ in
+            result.append(.init(name: name, offset: content.offset))
         }
+        return result
     }
 
     public func search(by key: String) -> ProgramOffset? {
@@ -122,6 +158,15 @@ extension TrieTreeProtocol where Content == ProgramsTrieNodeContent {
         return.init(name: key, offset: content.offset)
     }
 
+    public func search(byKeys keys: [String]) -> [ProgramOffset?] {
+        zip(keys, _search(byKeys: keys)).map { key, found in
+            guard let (_, content) = found else {
+                return nil
+            }
+            return .init(name: key, offset: content.offset)
+        }
+    }
+
     public func search(byKeyPrefix prefix: String) -> [ProgramOffset] {
         let found = _search(byKeyPrefix: prefix)
         return found.compactMap {
@@ -34,10 +34,16 @@ public class FullDyldCache: DyldCacheRepresentable, _DyldCacheFileRepresentable
     let fileHandle: File
     let _fileHandleIdentity: FileHandleIdentityBox
 
-    // Retain the symbol cache
-    private var _symbolCache: DyldCache?
+    // DyldCache wrappers of each file, created once and shared
+    private let _cacheStorage = CacheStorage()
     private var _mappingInfos: [DyldCacheMappingInfo]?
     private var _mappingAndSlideInfos: [DyldCacheMappingAndSlideInfo]?
+    // Guards the mapping infos above,
+    // since a cache is shared between threads by the concurrent drivers.
+    private let _mappingInfosLock = NSLock()
+    private let _imageIndexStorage = DyldCacheImageIndex.Storage()
+    private var _localSymbolsEntryIndex: DyldCacheLocalSymbolsEntryIndex?
+    private let _localSymbolsEntryIndexLock = NSLock()
 
     public var headerSize: Int {
         header.actualSize
@@ -60,9 +66,10 @@ public class FullDyldCache: DyldCacheRepresentable, _DyldCacheFileRepresentable
     // every time a `DyldCache` is assembled
     internal let subCacheHeaders: [DyldCacheHeader]
 
-    public init(url: URL) throws {
-        self.url = url
+    // Files and preloaded headers, retained by shared wrappers
+    internal let _sharedFiles: SharedFiles
 
+    public convenience init(url: URL) throws {
         let mainCache = try DyldCache(url: url)
 
         let subCacheSuffixes = mainCache.subCaches?.map {
@@ -77,17 +84,74 @@ public class FullDyldCache: DyldCacheRepresentable, _DyldCacheFileRepresentable
             urls: urls,
             isWritable: false
         )
-        self.fileHandle = fileHandle
-        self._fileHandleIdentity = FileHandleIdentityStore.identity(
-            for: fileHandle
+        self.init(
+            sharedFiles: .init(
+                url: url,
+                urls: urls,
+                fileHandle: fileHandle,
+                fileHandleIdentity: FileHandleIdentityStore.identity(
+                    for: fileHandle
+                ),
+                header: mainCache.header,
+                cpu: mainCache.cpu,
+                subCacheSuffixes: subCacheSuffixes,
+                subCacheHeaders: try fileHandle._files[1...].map {
+                    try $0._file.read(offset: 0)
+                }
+            )
         )
-        self.header = mainCache.header
-        self.cpu = mainCache.cpu
-        self.subCacheSuffixes = subCacheSuffixes
-        self.subCacheHeaders = try fileHandle._files[1...].map {
-            try $0._file.read(offset: 0)
+    }
+
+    /// Assemble a full cache from files that are already open,
+    /// without reopening or remapping them.
+    internal init(sharedFiles: SharedFiles) {
+        self._sharedFiles = sharedFiles
+        self.url = sharedFiles.url
+        self.fileHandle = sharedFiles.fileHandle
+        self._fileHandleIdentity = sharedFiles.fileHandleIdentity
+        self.header = sharedFiles.header
+        self.cpu = sharedFiles.cpu
+        self.subCacheSuffixes = sharedFiles.subCacheSuffixes
+        self.subCacheHeaders = sharedFiles.subCacheHeaders
+        self.urls = sharedFiles.urls
+    }
+}
+
+extension FullDyldCache {
+    /// Opened files of a full cache and their preloaded headers.
+    ///
+    /// Shared wrappers retain it strongly, so their file handles stay mapped
+    /// after the full cache that assembled them is released,
+    /// and the full cache can be assembled again from it.
+    final class SharedFiles: @unchecked Sendable {
+        let url: URL
+        let urls: [URL]
+        let fileHandle: File
+        let fileHandleIdentity: FileHandleIdentityBox
+        let header: DyldCacheHeader
+        let cpu: CPU
+        let subCacheSuffixes: [String]
+        let subCacheHeaders: [DyldCacheHeader]
+
+        init(
+            url: URL,
+            urls: [URL],
+            fileHandle: File,
+            fileHandleIdentity: FileHandleIdentityBox,
+            header: DyldCacheHeader,
+            cpu: CPU,
+            subCacheSuffixes: [String],
+            subCacheHeaders: [DyldCacheHeader]
+        ) {
+            self.url = url
+            self.urls = urls
+            self.fileHandle = fileHandle
+            self.fileHandleIdentity = fileHandleIdentity
+            self.header = header
+            self.cpu = cpu
+            self.subCacheSuffixes = subCacheSuffixes
+            self.subCacheHeaders = subCacheHeaders
         }
-        self.urls = urls
     }
 }
 
@@ -99,16 +163,7 @@ extension FullDyldCache {
 
 extension FullDyldCache {
     public var mainCache: DyldCache {
-        let cache: DyldCache = .init(
-            unsafeFileHandle: fileHandle._files[0]._file,
-            url: url,
-            cpu: cpu,
-            header: header,
-            mainCache: nil
-        )
-        cache._fullCache = self
-        cache._symbolCache = _symbolCache
-        return cache
+        cache(atIndex: 0)
     }
 
     public var subCaches: [DyldCache] {
@@ -125,7 +180,13 @@ extension FullDyldCache {
 extension FullDyldCache {
     /// Sequence of mapping infos
     public var mappingInfos: [DyldCacheMappingInfo]? {
-        if let _mappingInfos { return _mappingInfos }
+        _mappingInfosLock.lock()
+        if let _mappingInfos {
+            _mappingInfosLock.unlock()
+            return _mappingInfos
+        }
+        _mappingInfosLock.unlock()
+
         let mappingInfos = zip(fileHandle._files, allCaches).compactMap { file, cache in
             cache.mappingInfos?
                 .map {
@@ -134,13 +195,23 @@ extension FullDyldCache {
                     )
                 }
         }.flatMap { $0 }
+
+        _mappingInfosLock.lock()
+        defer { _mappingInfosLock.unlock() }
+        if let _mappingInfos { return _mappingInfos }
         _mappingInfos = mappingInfos
         return mappingInfos
     }
 
     /// Sequence of mapping and slide infos
     public var mappingAndSlideInfos: [DyldCacheMappingAndSlideInfo]? {
-        if let _mappingAndSlideInfos { return _mappingAndSlideInfos }
+        _mappingInfosLock.lock()
+        if let _mappingAndSlideInfos {
+            _mappingInfosLock.unlock()
+            return _mappingAndSlideInfos
+        }
+        _mappingInfosLock.unlock()
+
         let mappingAndSlideInfos = zip(fileHandle._files, allCaches).compactMap { file, cache in
             cache.mappingAndSlideInfos?
                 .map {
@@ -152,6 +223,10 @@ extension FullDyldCache {
                     )
                 }
         }.flatMap { $0 }
+
+        _mappingInfosLock.lock()
+        defer { _mappingInfosLock.unlock() }
+        if let _mappingAndSlideInfos { return _mappingAndSlideInfos }
         _mappingAndSlideInfos = mappingAndSlideInfos
         return mappingAndSlideInfos
     }
@@ -183,10 +258,7 @@ extension FullDyldCache {
     /// DyldCache containing unmapped local symbols
     public var symbolCache: DyldCache? {
         get throws {
-            if let _symbolCache = _symbolCache { return _symbolCache }
-            let symbolCache = try mainCache.symbolCache
-            _symbolCache = symbolCache
-            return symbolCache
+            try mainCache.symbolCache
         }
     }
 
@@ -201,13 +273,70 @@ extension FullDyldCache {
             }
             .first
     }
+
+    /// Index of local symbols entries by dylib offset
+    ///
+    /// It is built on first access and reused by
+    /// the `entry(for:in:)` lookups of ``DyldCacheLocalSymbolsInfo`` on this cache.
+    public var localSymbolsEntryIndex: DyldCacheLocalSymbolsEntryIndex? {
+        _localSymbolsEntryIndexLock.lock()
+        defer { _localSymbolsEntryIndexLock.unlock() }
+
+        if let _localSymbolsEntryIndex { return _localSymbolsEntryIndex }
+        guard let localSymbolsInfo else { return nil }
+        let index = DyldCacheLocalSymbolsEntryIndex(
+            info: localSymbolsInfo,
+            in: self
+        )
+        _localSymbolsEntryIndex = index
+        return index
+    }
+
+    /// Local symbols of all images contained in this cache.
+    ///
+    /// Local symbols are read from the main cache if it has them, otherwise from ``symbolCache``.
+    /// Each entry is found with an index of local symbols entries, so the symbol table and
+    /// the entries are only read once, and no ``MachOFile`` is created.
+    /// - Returns: Local symbols of images that have an entry, in image order
+    public func imageLocalSymbols() throws -> [DyldCacheImageLocalSymbols] {
+        let mainCache = self.mainCache
+        let symbolsCache: DyldCache
+        if mainCache.localSymbolsInfo != nil {
+            symbolsCache = mainCache
+        } else if let symbolCache = try symbolCache {
+            symbolsCache = symbolCache
+        } else {
+            return []
+        }
+        guard let info = symbolsCache.localSymbolsInfo,
+              let index = symbolsCache.localSymbolsEntryIndex,
+              let imageInfos else {
+            return []
+        }
+
+        let images = imageInfos.lazy.compactMap { info -> (imagePath: String, address: UInt64, headerOffset: UInt64)? in
+            guard let fileOffset = self.fileOffset(of: info.address),
+                  let imagePath = info.path(in: self),
+                  let fileIndex = self.fileIndex(forFileOffset: fileOffset) else {
+                return nil
+            }
+            let segment = self.fileHandle._files[fileIndex]
+            return (imagePath, info.address, fileOffset - numericCast(segment.offset))
+        }
+
+        return info._imageLocalSymbols(
+            for: images,
+            in: symbolsCache,
+            using: index,
+            sharedRegionStart: header.sharedRegionStart
+        )
+    }
 }
 
 extension FullDyldCache {
     /// Sequence of MachO information contained in this cache
     public func machOFiles() -> AnySequence<MachOFile> {
         guard let imageInfos else { return AnySequence([]) }
-        let mainCache = self.mainCache
         let machOFiles = imageInfos
             .lazy
             .compactMap { info in
@@ -222,7 +351,7 @@ extension FullDyldCache {
                 guard let index = self.fileIndex(forFileOffset: fileOffset) else {
                     return nil
                 }
-                let cache = self.cache(atIndex: index, mainCache: mainCache)
+                let cache = self.cache(atIndex: index)
                 let segment = self.fileHandle._files[index]
                 return try? .init(
                     url: cache.url,
@@ -235,6 +364,53 @@ extension FullDyldCache {
         return AnySequence(machOFiles)
     }
 
+    /// Get image info with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: image info
+    public func imageInfo(
+        forInstallName installName: String
+    ) -> DyldCacheImageInfo? {
+        imageIndex?.imageInfo(forInstallName: installName)
+    }
+
+    /// Get MachO with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// Unlike searching ``machOFiles()``, other images are not read.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: MachO file
+    public func machOFile(
+        forInstallName installName: String
+    ) -> MachOFile? {
+        guard let info = imageInfo(forInstallName: installName),
+              let fileOffset = self.fileOffset(of: info.address),
+              let imagePath = info.path(in: self),
+              let index = self.fileIndex(forFileOffset: fileOffset) else {
+            return nil
+        }
+        let cache = self.cache(atIndex: index)
+        let segment = self.fileHandle._files[index]
+        return try? .init(
+            url: cache.url,
+            imagePath: imagePath,
+            headerStartOffsetInCache: numericCast(fileOffset) - segment.offset,
+            cache: cache
+        )
+    }
+
+    private var imageIndex: DyldCacheImageIndex? {
+        _imageIndexStorage.index {
+            guard let imageInfos else { return nil }
+            return .init(
+                imageInfos: Array(imageInfos),
+                dylibIndices: dylibIndices,
+                path: { $0.path(in: self) }
+            )
+        }
+    }
+
     public var dyld: MachOFile? {
         guard let fileOffset = fileOffset(of: header.dyldInCacheMH) else {
             return nil
@@ -251,6 +427,172 @@ extension FullDyldCache {
     }
 }
 
+extension FullDyldCache {
+    /// Call `body` for every MachO contained in this cache, on multiple threads.
+    ///
+    /// Images are spread across workers with work stealing,
+    /// so a few large images do not leave other workers idle.
+    /// `body` is called in no particular order.
+    ///
+    /// One ``DyldCache`` is shared by all images in the same file.
+    /// Lazily loaded properties of this cache and the shared caches are loaded under a lock,
+    /// so they can be shared by `body` calls without loading anything beforehand.
+    /// Each MachO is only passed to one call.
+    /// - Parameters:
+    ///   - maxConcurrency: Maximum number of images processed concurrently.
+    ///   - body: Called from multiple threads.
+    public func concurrentForEachMachOFile(
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        _ body: (MachOFile) -> Void
+    ) {
+        _concurrentForEachMachOFile(
+            at: _machOFileLocations(),
+            maxConcurrency: maxConcurrency
+        ) { _, machO in
+            body(machO)
+        }
+    }
+
+    /// Transform every MachO contained in this cache, on multiple threads.
+    ///
+    /// Results are in the order of ``imageInfos``, regardless of scheduling,
+    /// so the result at an index belongs to the image info at the same index.
+    /// - Parameters:
+    ///   - maxConcurrency: Maximum number of images processed concurrently.
+    ///   - transform: Called from multiple threads.
+    /// - Returns: Transformed values in image order.
+    ///   `nil` for images that cannot be loaded.
+    public func concurrentMapMachOFiles<T>(
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        _ transform: (MachOFile) -> T
+    ) -> [T?] {
+        let locations = _machOFileLocations()
+        var results = [T?](repeating: nil, count: locations.count)
+        results.withUnsafeMutableBufferPointer { results in
+            _concurrentForEachMachOFile(
+                at: locations,
+                maxConcurrency: maxConcurrency
+            ) { index, machO in
+                results[index] = transform(machO)
+            }
+        }
+        return results
+    }
+
+    private func _concurrentForEachMachOFile(
+        at locations: [(imagePath: String, fileOffset: UInt64, fileIndex: Int)?],
+        maxConcurrency: Int,
+        _ body: (Int, MachOFile) -> Void
+    ) {
+        let caches = (0 ..< fileHandle._files.count).map {
+            cache(atIndex: $0)
+        }
+
+        WorkStealingScheduler.run(
+            count: locations.count,
+            maxConcurrency: maxConcurrency
+        ) { index in
+            guard let location = locations[index] else { return }
+            let cache = caches[location.fileIndex]
+            let segment = self.fileHandle._files[location.fileIndex]
+            guard let machO = try? MachOFile(
+                url: cache.url,
+                imagePath: location.imagePath,
+                headerStartOffsetInCache: numericCast(location.fileOffset) - segment.offset,
+                cache: cache
+            ) else { return }
+            body(index, machO)
+        }
+    }
+
+    /// Paths, file offsets and file indices of the images in this cache, in image order.
+    /// `nil` for images whose path or file offset is not found.
+    private func _machOFileLocations() -> [(imagePath: String, fileOffset: UInt64, fileIndex: Int)?] {
+        guard let imageInfos else { return [] }
+        return imageInfos.map { info in
+            guard let fileOffset = self.fileOffset(of: info.address),
+                  let imagePath = info.path(in: self),
+                  let fileIndex = self.fileIndex(forFileOffset: fileOffset) else {
+                return nil
+            }
+            return (imagePath, fileOffset, fileIndex)
+        }
+    }
+}
+
+extension FullDyldCache {
+    /// Create a symbolicator for unslid addresses in this cache.
+    ///
+    /// Load commands of all images are read to build the image range table,
+    /// spread across `maxConcurrency` threads.
+    /// Symbols of each image are indexed lazily, on the first lookup that hits it.
+    /// The symbolicator should be kept and reused for many lookups.
+    /// - Parameter maxConcurrency: Maximum number of images read concurrently.
+    /// - Returns: Symbolicator for this cache
+    public func makeSymbolicator(
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) throws -> DyldCacheSymbolicator {
+        typealias Image = DyldCacheSymbolicator.Image
+        typealias ImageRange = DyldCacheSymbolicator.ImageRange
+
+        let loaded = concurrentMapMachOFiles(
+            maxConcurrency: maxConcurrency
+        ) { machO -> (image: Image, ranges: [(start: UInt64, end: UInt64)])? in
+            let segments = machO.segments
+            guard let text = segments.first(where: { $0.segmentName == SEG_TEXT }) else {
+                return nil
+            }
+            // __LINKEDIT is shared by all images
+            let ranges = segments
+                .filter { $0.segmentName != SEG_LINKEDIT && $0.virtualMemorySize > 0 }
+                .map { segment -> (start: UInt64, end: UInt64) in
+                    let start: UInt64 = numericCast(segment.virtualMemoryAddress)
+                    return (start, start + numericCast(segment.virtualMemorySize))
+                }
+            return (
+                .init(machO: machO, address: numericCast(text.virtualMemoryAddress)),
+                ranges
+            )
+        }.compactMap { $0 ?? nil }
+
+        var images: [Image] = []
+        var ranges: [ImageRange] = []
+        images.reserveCapacity(loaded.count)
+        for (image, imageRanges) in loaded {
+            let imageIndex = images.count
+            images.append(image)
+            ranges += imageRanges.map {
+                ImageRange(start: $0.start, end: $0.end, imageIndex: imageIndex)
+            }
+        }
+
+        let mainCache = self.mainCache
+        let symbolsCache: DyldCache?
+        if mainCache.localSymbolsInfo != nil {
+            symbolsCache = mainCache
+        } else {
+            symbolsCache = try symbolCache
+        }
+        var localSymbols: DyldCacheSymbolicator.LocalSymbols?
+        if let symbolsCache,
+           let info = symbolsCache.localSymbolsInfo,
+           let index = symbolsCache.localSymbolsEntryIndex {
+            if let symbols64 = info.symbols64(in: symbolsCache) {
+                localSymbols = .init(symbols: .symbols64(symbols64), index: index)
+            } else if let symbols32 = info.symbols32(in: symbolsCache) {
+                localSymbols = .init(symbols: .symbols32(symbols32), index: index)
+            }
+        }
+
+        return .init(
+            images: images,
+            ranges: ranges,
+            localSymbols: localSymbols,
+            sharedRegionStart: header.sharedRegionStart
+        )
+    }
+}
+
 extension FullDyldCache {
     /// File offset after rebasing performed on the specified file offset
     /// - Parameter offset: target file offset
@@ -272,6 +614,34 @@ extension FullDyldCache {
     }
 }
 
+extension FullDyldCache {
+    /// Rebases in the specified mapping, decoded page by page from its slide info.
+    ///
+    /// Each page is decoded by walking its delta chains once,
+    /// so resolving all pointers in a mapping is a single pass.
+    /// Targets are the same values as ``resolveRebase(at:)`` returns for each pointer.
+    /// - Parameter mapping: mapping with slide info
+    /// - Returns: rebases of all pages, or `nil` if the mapping has no slide info
+    public func rebases(
+        in mapping: DyldCacheMappingAndSlideInfo
+    ) -> DyldCacheSlideRebases? {
+        _rebases(in: mapping)
+    }
+
+    /// Read-only view of the cache memory after sliding, with pages materialized on demand.
+    /// - Parameters:
+    ///   - slide: slide added to the targets of rebased pointers
+    ///   - maxPageCount: maximum number of 16KB pages kept in memory
+    /// - Returns: slid view of the mappings,
+    ///   or `nil` if the cache has no slide info in its mappings or it cannot be decoded
+    public func slidView(
+        slide: UInt64 = 0,
+        maxPageCount: Int = 1024
+    ) -> DyldCacheSlidView? {
+        _slidView(slide: slide, maxPageCount: maxPageCount)
+    }
+}
+
 extension FullDyldCache {
     /// Returns the cache file URL that contains the specified file offset in the full cache.
     /// - Parameter fileOffset: A file offset from the start of the full cache's concatenated file view.
@@ -374,26 +744,68 @@ extension FullDyldCache {
 }
 
 extension FullDyldCache {
+    /// The shared `DyldCache` for the file at `index`.
+    ///
+    /// It is assembled on first access and reused,
+    /// so its lazily computed properties are computed once per full cache.
+    internal func cache(atIndex index: Int) -> DyldCache {
+        _cacheStorage.cache(atIndex: index) {
+            makeCache(atIndex: $0)
+        }
+    }
+
     /// Assemble the `DyldCache` for the file at `index` from the
     /// preloaded header, without re-reading it from the file
-    internal func cache(
-        atIndex index: Int,
-        mainCache: DyldCache? = nil
-    ) -> DyldCache {
-        if index == 0 { return mainCache ?? self.mainCache }
-        let cache: DyldCache = .init(
-            unsafeFileHandle: fileHandle._files[index]._file,
-            url: urls[index],
-            cpu: cpu,
-            header: subCacheHeaders[index - 1],
-            mainCache: mainCache,
-            mainCacheHeader: header
-        )
-        cache._fullCache = self
+    private func makeCache(atIndex index: Int) -> DyldCache {
+        let cache: DyldCache
+        if index == 0 {
+            cache = .init(
+                unsafeFileHandle: fileHandle._files[0]._file,
+                url: url,
+                cpu: cpu,
+                header: header,
+                mainCache: nil
+            )
+        } else {
+            cache = .init(
+                unsafeFileHandle: fileHandle._files[index]._file,
+                url: urls[index],
+                cpu: cpu,
+                header: subCacheHeaders[index - 1],
+                mainCache: self.cache(atIndex: 0),
+                mainCacheHeader: header
+            )
+        }
+        // `self` owns the cache, so it is referenced weakly from the cache.
+        // The files are retained instead, since the cache maps them.
+        cache._setOwnerFullCache(self, sharedFiles: _sharedFiles)
         return cache
     }
 }
 
+extension FullDyldCache {
+    /// Lazily assembled `DyldCache` wrappers, shared by all accesses
+    final class CacheStorage: @unchecked Sendable {
+        // Recursive, since assembling a subcache needs the main cache
+        private let lock = NSRecursiveLock()
+        private var caches: [Int: DyldCache] = [:]
+
+        init() {}
+
+        func cache(
+            atIndex index: Int,
+            _ make: (Int) -> DyldCache
+        ) -> DyldCache {
+            lock.lock()
+            defer { lock.unlock() }
+            if let cache = caches[index] { return cache }
+            let cache = make(index)
+            caches[index] = cache
+            return cache
+        }
+    }
+}
+
 extension FullDyldCache {
     public func mappingInfo(for address: UInt64) -> DyldCacheMappingInfo? {
         guard let mappings = self.mappingInfos else { return nil }
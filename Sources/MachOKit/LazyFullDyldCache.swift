@@ -0,0 +1,230 @@
+//
+//  LazyFullDyldCache.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// `LazyFullDyldCache` represents a complete dyld shared cache like ``FullDyldCache``,
+/// but opens subcache files only when they are needed.
+///
+/// Only the main cache file is opened on initialization.
+/// The address range of each subcache is known from the subcache entries of the main cache,
+/// so a subcache file is opened and mapped the first time an address resolves into it.
+///
+/// At most ``maxMappedSubCaches`` subcaches stay mapped at once.
+/// When more are needed, the least recently used subcache is released.
+/// Its file is unmapped once no ``DyldCache`` or ``MachOFile`` obtained from it is retained.
+///
+/// - SeeAlso: ``FullDyldCache``, ``DyldCache``
+public final class LazyFullDyldCache: @unchecked Sendable {
+    /// URL of main cache file
+    public let url: URL
+
+    /// Main cache, which is always mapped
+    public let mainCache: DyldCache
+
+    /// Subcache entries in the main cache
+    public let subCacheEntries: [DyldSubCacheEntry]
+
+    /// Maximum number of subcaches mapped at once
+    public let maxMappedSubCaches: Int
+
+    private struct SubCacheRange {
+        let start: UInt64
+        let end: UInt64
+        /// Index in `subCacheEntries`
+        let index: Int
+    }
+
+    /// VM ranges of subcaches, sorted by start address
+    private let subCacheRanges: [SubCacheRange]
+
+    private let lock = NSLock()
+    private var subCaches: LRUCache<Int, DyldCache>
+
+    /// Load main dyld cache, without opening subcaches.
+    /// - Parameters:
+    ///   - url: url for main dyld cache
+    ///   - maxMappedSubCaches: maximum number of subcaches mapped at once
+    public init(
+        url: URL,
+        maxMappedSubCaches: Int = 4
+    ) throws {
+        let mainCache = try DyldCache(url: url)
+        let subCacheEntries = mainCache.subCaches.map(Array.init) ?? []
+
+        self.url = url
+        self.mainCache = mainCache
+        self.subCacheEntries = subCacheEntries
+        self.maxMappedSubCaches = max(1, maxMappedSubCaches)
+        self.subCaches = .init(capacity: max(1, maxMappedSubCaches))
+
+        // Each subcache extends to the start of the next one
+        let header = mainCache.header
+        let sharedRegionStart = header.sharedRegionStart
+        let sharedRegionEnd = sharedRegionStart + header.sharedRegionSize
+        let starts = subCacheEntries.enumerated()
+            .map { (start: sharedRegionStart + $1.cacheVMOffset, index: $0) }
+            .sorted { ($0.start, $0.index) < ($1.start, $1.index) }
+        self.subCacheRanges = starts.enumerated().map { position, entry -> SubCacheRange in
+            let end = position + 1 < starts.count
+                ? starts[position + 1].start
+                : max(sharedRegionEnd, entry.start)
+            return SubCacheRange(
+                start: entry.start,
+                end: end,
+                index: entry.index
+            )
+        }
+    }
+}
+
+extension LazyFullDyldCache {
+    /// Header for main dyld cache
+    public var header: DyldCacheHeader {
+        mainCache.header
+    }
+
+    /// Target CPU info.
+    public var cpu: CPU {
+        mainCache.cpu
+    }
+
+    /// URLs of subcache files, in the order of ``subCacheEntries``
+    public var subCacheURLs: [URL] {
+        subCacheEntries.map {
+            URL(fileURLWithPath: url.path + $0.fileSuffix, isDirectory: false)
+        }
+    }
+
+    /// Number of currently mapped subcaches
+    public var mappedSubCacheCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return subCaches.count
+    }
+
+    /// Symbol cache (`.symbols`), opened on first access
+    ///
+    /// Opened without holding the lock for subcaches, so they can be opened meanwhile.
+    /// The main cache keeps the first one opened.
+    public var symbolCache: DyldCache? {
+        get throws {
+            try mainCache.symbolCache
+        }
+    }
+}
+
+extension LazyFullDyldCache {
+    /// Get the subcache at the index, opening it if it is not mapped.
+    /// - Parameter index: index in ``subCacheEntries``
+    /// - Returns: subcache
+    public func subCache(at index: Int) throws -> DyldCache {
+        precondition(
+            subCacheEntries.indices.contains(index),
+            "index out of range"
+        )
+
+        lock.lock()
+        if let subCache = subCaches.value(forKey: index) {
+            lock.unlock()
+            return subCache
+        }
+        lock.unlock()
+
+        // Open outside the lock, so mapped subcaches can be used meanwhile
+        let url = URL(
+            fileURLWithPath: self.url.path + subCacheEntries[index].fileSuffix,
+            isDirectory: false
+        )
+        let subCache = try DyldCache(subcacheUrl: url, mainCache: mainCache)
+
+        lock.lock()
+        defer { lock.unlock() }
+        if let subCache = subCaches.value(forKey: index) {
+            return subCache
+        }
+        subCaches.setValue(subCache, forKey: index)
+        return subCache
+    }
+
+    /// Get the cache (main cache or subcache) that maps the address.
+    ///
+    /// The subcache is opened if it is not mapped.
+    /// - Parameter address: unslid vmaddr
+    /// - Returns: cache containing the address
+    public func cache(containing address: UInt64) -> DyldCache? {
+        if mainCache.mappingInfo(for: address) != nil {
+            return mainCache
+        }
+        guard let range = subCacheRange(containing: address),
+              let subCache = try? subCache(at: range.index),
+              subCache.mappingInfo(for: address) != nil else {
+            return nil
+        }
+        return subCache
+    }
+
+    /// Convert the address to a file offset in the cache that maps it.
+    /// - Parameter address: unslid vmaddr
+    /// - Returns: cache containing the address, and the file offset in its file
+    public func fileOffset(
+        of address: UInt64
+    ) -> (cache: DyldCache, fileOffset: UInt64)? {
+        guard let cache = cache(containing: address),
+              let fileOffset = cache.fileOffset(of: address) else {
+            return nil
+        }
+        return (cache, fileOffset)
+    }
+
+    /// Get MachO with the specified install name.
+    ///
+    /// Aliases of install names are also resolved.
+    /// Only the subcache containing the image is opened.
+    /// - Parameter installName: install name or alias of image
+    /// - Returns: MachO file
+    public func machOFile(
+        forInstallName installName: String
+    ) -> MachOFile? {
+        guard let info = mainCache.imageInfo(forInstallName: installName),
+              let cache = cache(containing: info.address) else {
+            return nil
+        }
+        return cache.machOFile(forInstallName: installName)
+    }
+
+    /// Release all mapped subcaches.
+    ///
+    /// Files are unmapped once no objects obtained from them are retained.
+    public func unmapSubCaches() {
+        lock.lock()
+        defer { lock.unlock() }
+        subCaches.removeAll()
+    }
+}
+
+extension LazyFullDyldCache {
+    private func subCacheRange(containing address: UInt64) -> SubCacheRange? {
+        // first range whose start is greater than `address`
+        var lower = subCacheRanges.startIndex
+        var upper = subCacheRanges.endIndex
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if subCacheRanges[middle].start <= address {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        guard lower != subCacheRanges.startIndex,
+              address < subCacheRanges[lower - 1].end else {
+            return nil
+        }
+        return subCacheRanges[lower - 1]
+    }
+}
@@ -160,85 +160,82 @@ extension MachOFile.DyldChainedFixups {
         of startsInSegment: DyldChainedStartsInSegment,
         in machO: MachOFile
     ) -> [DyldChainedFixupPointer] {
-        let pages = pages(of: startsInSegment)
-        guard pages.count > 0, startsInSegment.page_size > 0 else { return [] }
-
-        let pagesFileSlice = try! machO.fileHandle.fileSlice(
-            offset: machO.headerStartOffset + numericCast(startsInSegment.segment_offset),
-            length: pages.count * numericCast(startsInSegment.page_size)
-        )
-
         var pointers: [DyldChainedFixupPointer] = []
-
-        for (index, page) in pages.enumerated() {
-            var offsetInPage = page.offset
-
-            if page.isNone { continue }
-            if page.isMulti {
-                var overflowIndex = Int(offsetInPage & ~UInt16(DYLD_CHAINED_PTR_START_MULTI))
-                var chainEnd = false
-                while !chainEnd {
-                    chainEnd = pages[overflowIndex].offset & UInt16(DYLD_CHAINED_PTR_START_LAST) != 0
-                    offsetInPage = pages[overflowIndex].offset & ~UInt16(DYLD_CHAINED_PTR_START_LAST)
-                    let pageContentStart: Int = index * numericCast(startsInSegment.page_size)
-                    let chainOffset = pageContentStart + numericCast(offsetInPage)
-                    walkChain(offset: chainOffset, pagesFileSlice: pagesFileSlice, of: startsInSegment, pointers: &pointers)
-                    overflowIndex += 1
-                }
-            } else {
-                let pageContentStart: Int = index * numericCast(startsInSegment.page_size)
-                let chainOffset = pageContentStart + numericCast(offsetInPage)
-                walkChain(offset: chainOffset, pagesFileSlice: pagesFileSlice, of: startsInSegment, pointers: &pointers)
-            }
+        forEachPointer(of: startsInSegment, in: machO) { pointer, _ in
+            pointers.append(pointer)
         }
-
         return pointers
     }
 
-    private func walkChain(
-        offset: Int,
-        pagesFileSlice: FileSlice,
+    /// Call the closure with each fixup in the segment, one at a time.
+    ///
+    /// Fixups are visited in page order, and in chain order within a page,
+    /// without collecting them into an array.
+    /// - Parameters:
+    ///   - startsInSegment: chain starts of the segment
+    ///   - machO: MachOFile to which `self` belongs
+    ///   - filter: kind of fixups to visit
+    ///   - body: closure called with each fixup. Set `stop` to true to end the traversal.
+    public func forEachPointer(
         of startsInSegment: DyldChainedStartsInSegment,
-        pointers: inout [DyldChainedFixupPointer]
-    ) {
-        guard let pointerFormat = startsInSegment.pointerFormat else {
+        in machO: MachOFile,
+        filter: DyldChainedFixupPointerFilter = .all,
+        _ body: (_ pointer: DyldChainedFixupPointer, _ stop: inout Bool) throws -> Void
+    ) rethrows {
+        guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
             return
         }
-        var offset = offset
+        let segmentOffset: Int = numericCast(startsInSegment.segment_offset)
 
-        let stride = pointerFormat.stride
         var stop = false
-        var chainEnd = false
-
-        while !stop && !chainEnd {
-            guard let fixupInfo = _fixupInfo(
-                at: offset,
-                in: pagesFileSlice,
-                pointerFormat: pointerFormat
-            ) else {
-                stop = true
-                continue
-            }
-
-            let pointerOffset = numericCast(startsInSegment.segment_offset) + offset
-
-            pointers.append(
+        try walker.walk { offset, _, fixupInfo in
+            guard filter.matches(fixupInfo) else { return true }
+            try body(
                 DyldChainedFixupPointer(
-                    offset: pointerOffset,
+                    offset: segmentOffset + offset,
                     fixupInfo: fixupInfo
-                )
+                ),
+                &stop
             )
+            return !stop
+        }
+    }
 
-            if fixupInfo.next == 0 {
-                chainEnd = true
-            } else {
-                offset += stride * fixupInfo.next
+    /// Call the closure with each fixup in all segments, one at a time.
+    /// - Parameters:
+    ///   - machO: MachOFile to which `self` belongs
+    ///   - filter: kind of fixups to visit
+    ///   - body: closure called with each fixup. Set `stop` to true to end the traversal.
+    public func forEachPointer(
+        in machO: MachOFile,
+        filter: DyldChainedFixupPointerFilter = .all,
+        _ body: (_ pointer: DyldChainedFixupPointer, _ stop: inout Bool) throws -> Void
+    ) rethrows {
+        guard let startsInImage else { return }
+        var stop = false
+        for startsInSegment in startsInSegments(of: startsInImage) {
+            try forEachPointer(
+                of: startsInSegment,
+                in: machO,
+                filter: filter
+            ) { pointer, segmentStop in
+                try body(pointer, &stop)
+                segmentStop = stop
             }
+            if stop { break }
         }
     }
 }
 
 extension MachOFile.DyldChainedFixups {
+    /// Fixup at the offset.
+    ///
+    /// Uses the sorted index of the segment containing the offset,
+    /// which is built on first access and reused by subsequent lookups on `machO`.
+    /// - Parameters:
+    ///   - offset: offset from start of mach header
+    ///   - machO: MachOFile to which `self` belongs
+    /// - Returns: fixup, or `nil` if there is no fixup at the offset
     public func pointer(for offset: UInt64, in machO: MachOFile) -> DyldChainedFixupPointer? {
         guard let startsInImage = startsInImage else { return nil }
         guard let startsInSegment = startsInSegments(of: startsInImage)
@@ -248,188 +245,161 @@ extension MachOFile.DyldChainedFixups {
             }) else {
             return nil
         }
-
-        let pages = pages(of: startsInSegment)
-
-        let pagesFileSlice = try! machO.fileHandle.fileSlice(
-            offset: machO.headerStartOffset + numericCast(startsInSegment.segment_offset),
-            length: pages.count * numericCast(startsInSegment.page_size)
-        )
-
-        for (index, page) in pages.enumerated() {
-            var offsetInPage = page.offset
-
-            if page.isNone { continue }
-            if page.isMulti {
-                var overflowIndex = Int(offsetInPage & ~UInt16(DYLD_CHAINED_PTR_START_MULTI))
-                var chainEnd = false
-                while !chainEnd {
-                    chainEnd = pages[overflowIndex].offset & UInt16(DYLD_CHAINED_PTR_START_LAST) != 0
-                    offsetInPage = pages[overflowIndex].offset & ~UInt16(DYLD_CHAINED_PTR_START_LAST)
-                    let pageContentStart: Int = index * numericCast(startsInSegment.page_size)
-                    let chainOffset = pageContentStart + numericCast(offsetInPage)
-
-                    if let pointer = walkChainAndFindPointer(
-                        for: offset,
-                        chainOffset: chainOffset,
-                        pagesFileSlice: pagesFileSlice,
-                        of: startsInSegment
-                    ) {
-                        return pointer
-                    }
-
-                    overflowIndex += 1
-                }
-            } else {
-                let pageContentStart: Int = index * numericCast(startsInSegment.page_size)
-                let chainOffset = pageContentStart + numericCast(offsetInPage)
-
-                if let pointer = walkChainAndFindPointer(
-                    for: offset,
-                    chainOffset: chainOffset,
-                    pagesFileSlice: pagesFileSlice,
-                    of: startsInSegment
-                ) {
-                    return pointer
-                }
-
-            }
-        }
-
-        return nil
+        return fixupIndex(of: startsInSegment, in: machO)?
+            .pointer(for: offset)
     }
-    private func walkChainAndFindPointer(
-        for targetOffset: UInt64,
-        chainOffset: Int,
-        pagesFileSlice: FileSlice,
-        of startsInSegment: DyldChainedStartsInSegment
-    ) -> DyldChainedFixupPointer? {
-        guard let pointerFormat = startsInSegment.pointerFormat else {
-            return nil
-        }
-        var chainOffset = chainOffset
-
-        let stride = pointerFormat.stride
-        var stop = false
-        var chainEnd = false
-
-        while !stop && !chainEnd {
-            guard let fixupInfo = _fixupInfo(
-                at: chainOffset,
-                in: pagesFileSlice,
-                pointerFormat: pointerFormat
-            ) else {
-                stop = true
-                continue
-            }
-
-            let pointerOffset = numericCast(startsInSegment.segment_offset) + chainOffset
-
-            if pointerOffset == targetOffset {
-                return DyldChainedFixupPointer(
-                    offset: pointerOffset,
-                    fixupInfo: fixupInfo
-                )
-            }
 
-            if fixupInfo.next == 0 {
-                chainEnd = true
-            } else {
-                chainOffset += stride * fixupInfo.next
+    /// Sorted index of fixups in the segment.
+    ///
+    /// It is built on first access and reused by subsequent lookups on `machO`.
+    /// - Parameters:
+    ///   - startsInSegment: chain starts of the segment
+    ///   - machO: MachOFile to which `self` belongs
+    /// - Returns: index of fixups, or `nil` if the pointer format is not supported
+    public func fixupIndex(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOFile
+    ) -> DyldChainedFixupIndex? {
+        machO._dyldChainedFixupIndex(for: startsInSegment.segmentIndex) {
+            guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+                return nil
             }
+            return .init(
+                walker: walker,
+                segmentIndex: startsInSegment.segmentIndex,
+                segmentOffset: numericCast(startsInSegment.segment_offset)
+            )
         }
-
-        return nil
     }
 }
 
 extension MachOFile.DyldChainedFixups {
-    @inline(__always)
-    private func _fixupInfo(
-        at offset: Int,
-        in pagesFileSlice: FileSlice,
-        pointerFormat: DyldChainedFixupPointerFormat
-    ) -> DyldChainedFixupPointerInfo? {
-        var fixupInfo: DyldChainedFixupPointerInfo?
-
-        if pointerFormat.is64Bit {
-//            faster than below code
-//            let rawValue = data.advanced(by: offset).withUnsafeBytes {
-//                $0.load(as: UInt64.self)
-//            }
-            guard let rawValue: UInt64 = try? pagesFileSlice.read(
-                offset: offset,
-                as: UInt64.self
-            ) else {
-                return nil
-            }
+    /// Fixups in the segment, decoded on multiple threads.
+    ///
+    /// Pages are decoded concurrently and the fixups are returned sorted by offset,
+    /// regardless of `maxConcurrency` or scheduling.
+    /// For chains in ascending order, as linkers emit them,
+    /// the result equals that of ``pointers(of:in:)``.
+    /// - Parameters:
+    ///   - startsInSegment: chain starts of the segment
+    ///   - machO: MachOFile to which `self` belongs
+    ///   - filter: kind of fixups to decode
+    ///   - maxConcurrency: Maximum number of pages decoded concurrently
+    /// - Returns: fixups sorted by offset
+    public func concurrentPointers(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOFile,
+        filter: DyldChainedFixupPointerFilter = .all,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> [DyldChainedFixupPointer] {
+        guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+            return []
+        }
+        return DyldChainedFixupConcurrentDecoder.pointers(
+            of: [(walker, numericCast(startsInSegment.segment_offset))],
+            filter: filter,
+            maxConcurrency: maxConcurrency
+        )
+    }
 
-            switch pointerFormat {
-            case .arm64e, .arm64e_kernel, .arm64e_userland, .arm64e_firmware:
-                let content = DyldChainedFixupPointerInfo.ARM64E(rawValue: rawValue)
-                switch pointerFormat {
-                case .arm64e:
-                    fixupInfo = .arm64e(content)
-                case .arm64e_kernel:
-                    fixupInfo = .arm64e_kernel(content)
-                case .arm64e_userland:
-                    fixupInfo = .arm64e_userland(content)
-                case .arm64e_firmware:
-                    fixupInfo = .arm64e_firmware(content)
-                default: break
+    /// Fixups in all segments, decoded on multiple threads.
+    ///
+    /// Pages of all segments are decoded concurrently and the fixups are returned sorted by offset,
+    /// regardless of `maxConcurrency` or scheduling.
+    /// - Parameters:
+    ///   - machO: MachOFile to which `self` belongs
+    ///   - filter: kind of fixups to decode
+    ///   - maxConcurrency: Maximum number of pages decoded concurrently
+    /// - Returns: fixups sorted by offset
+    public func concurrentPointers(
+        in machO: MachOFile,
+        filter: DyldChainedFixupPointerFilter = .all,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> [DyldChainedFixupPointer] {
+        guard let startsInImage else { return [] }
+        let segments = startsInSegments(of: startsInImage)
+            .compactMap { startsInSegment -> DyldChainedFixupConcurrentDecoder.Segment? in
+                guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+                    return nil
                 }
+                return (walker, numericCast(startsInSegment.segment_offset))
+            }
+        return DyldChainedFixupConcurrentDecoder.pointers(
+            of: segments,
+            filter: filter,
+            maxConcurrency: maxConcurrency
+        )
+    }
+}
 
-            case .arm64e_userland24:
-                let content = DyldChainedFixupPointerInfo.ARM64EUserland24(rawValue: rawValue)
-                fixupInfo = .arm64e_userland24(content)
-
-            case ._64, ._64_offset:
-                let content = DyldChainedFixupPointerInfo.General64(rawValue: rawValue)
-                switch pointerFormat {
-                case ._64: fixupInfo = ._64(content)
-                case ._64_offset: fixupInfo = ._64_offset(content)
-                default: break
-                }
+extension MachOFile.DyldChainedFixups {
+    internal func _chainWalker(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOFile
+    ) -> DyldChainedFixupChainWalker? {
+        let pageCount: Int = numericCast(startsInSegment.page_count)
+        let pageSize: Int = numericCast(startsInSegment.page_size)
+        guard pageCount > 0, pageSize > 0,
+              let pointerFormat = startsInSegment.pointerFormat,
+              let pagesFileSlice = try? machO.fileHandle.fileSlice(
+                offset: machO.headerStartOffset + numericCast(startsInSegment.segment_offset),
+                length: pageCount * pageSize
+              ) else {
+            return nil
+        }
+        let is64Bit = pointerFormat.is64Bit
 
-            case ._64_kernel_cache, .x86_64_kernel_cache:
-                let content = DyldChainedFixupPointerInfo.General64Cache(rawValue: rawValue)
-                switch pointerFormat {
-                case ._64_kernel_cache:
-                    fixupInfo = ._64_kernel_cache(content)
-                case .x86_64_kernel_cache:
-                    fixupInfo = .x86_64_kernel_cache(content)
-                default: break
+        return _chainWalker(of: startsInSegment) { offset in
+            if is64Bit {
+                return try? pagesFileSlice.read(
+                    offset: offset,
+                    as: UInt64.self
+                )
+            } else {
+                guard let value: UInt32 = try? pagesFileSlice.read(
+                    offset: offset
+                ) else {
+                    return nil
                 }
-
-            case .arm64e_shared_cache:
-                let content = DyldChainedFixupPointerInfo.ARM64ESharedCache(rawValue: rawValue)
-                fixupInfo = .arm64e_shared_cache(content)
-
-            default:
-                break
-            }
-        } else {
-            guard let rawValue: UInt32 = try? pagesFileSlice.read(
-                offset: offset
-            ) else {
-                return nil
-            }
-
-            switch pointerFormat {
-            case ._32:
-                let content = DyldChainedFixupPointerInfo.General32(rawValue: rawValue)
-                fixupInfo = ._32(content)
-            case ._32_cache:
-                let content = DyldChainedFixupPointerInfo.General32Cache(rawValue: rawValue)
-                fixupInfo = ._32_cache(content)
-            case ._32_firmware:
-                let content = DyldChainedFixupPointerInfo.General32Firmware(rawValue: rawValue)
-                fixupInfo = ._32_firmware(content)
-            default:
-                break
+                return numericCast(value)
             }
         }
+    }
 
-        return fixupInfo
+    /// Chain walker of the segment whose contents are read by `rawValue`
+    internal func _chainWalker(
+        of startsInSegment: DyldChainedStartsInSegment,
+        rawValue: @escaping (Int) -> UInt64?
+    ) -> DyldChainedFixupChainWalker? {
+        let pageCount: Int = numericCast(startsInSegment.page_count)
+        guard pageCount > 0 else { return nil }
+
+        // `page_start` is followed by overflow entries of multi-start pages,
+        // up to the end of `dyld_chained_starts_in_segment`.
+        let pageStartOffset = startsInSegment.offset + startsInSegment.layoutOffset(of: \.page_start)
+        let pageStartCount = max(
+            pageCount,
+            (Int(startsInSegment.size) - startsInSegment.layoutOffset(of: \.page_start)) / MemoryLayout<UInt16>.size
+        )
+        let pageStarts = UnsafeBufferPointer(
+            start: fileSlice.ptr
+                .advanced(by: pageStartOffset)
+                .assumingMemoryBound(to: UInt16.self),
+            count: min(
+                pageStartCount,
+                (fileSlice.size - pageStartOffset) / MemoryLayout<UInt16>.size
+            )
+        )
+        let isSwapped = isSwapped
+
+        return .init(
+            startsInSegment: startsInSegment,
+            pageStart: { index in
+                guard pageStarts.indices.contains(index) else { return nil }
+                let value = pageStarts[index]
+                return isSwapped ? value.byteSwapped : value
+            },
+            rawValue: rawValue
+        )
     }
 }
@@ -0,0 +1,174 @@
+//
+//  MachOFile+ImageMapping.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+#if compiler(>=6.0) || (compiler(>=5.10) && hasFeature(AccessLevelOnImport))
+internal import FileIO
+internal import FileIOBinary
+#else
+@_implementationOnly import FileIO
+@_implementationOnly import FileIOBinary
+#endif
+
+extension MachOFile {
+    /// Size of the buffer needed to map this image with
+    /// ``mapImage(into:baseAddress:maxConcurrency:resolver:)``.
+    ///
+    /// It spans from the preferred load address (vmaddr of `__TEXT`)
+    /// to the end of the last segment. `nil` if there is no `__TEXT` segment.
+    public var mappedImageSize: Int? {
+        guard let preferredLoadAddress = _preferredLoadAddress else {
+            return nil
+        }
+        let end = _mappedSegments(preferredLoadAddress: preferredLoadAddress)
+            .map { $0.virtualMemoryAddress + $0.virtualMemorySize }
+            .max() ?? numericCast(preferredLoadAddress)
+        return end - numericCast(preferredLoadAddress)
+    }
+
+    /// Map this image into the buffer and apply all of its fixups,
+    /// so that the buffer holds the image as dyld would lay it out at `baseAddress`.
+    ///
+    /// Segments are copied to their offsets from `__TEXT`
+    /// and the remaining bytes of the buffer up to ``mappedImageSize`` are zero-filled.
+    /// Then chained fixups of all pointer formats except `DYLD_CHAINED_PTR_ARM64E_SEGMENTED` are applied
+    /// in place, page by page on up to `maxConcurrency` threads.
+    /// For images with classic dyld info, rebases, binds, lazy binds and weak binds are applied in this order.
+    ///
+    /// Each bind target is passed to `resolver` once, before any page of chained fixups is patched.
+    /// Weak binds are resolved with `BIND_SPECIAL_DYLIB_WEAK_LOOKUP` as the library ordinal,
+    /// and are left as they are if not resolved.
+    /// Authenticated pointers are written without signing.
+    ///
+    /// - Parameters:
+    ///   - buffer: buffer of at least ``mappedImageSize`` bytes
+    ///   - baseAddress: address at which the image is loaded
+    ///   - maxConcurrency: Maximum number of pages patched concurrently
+    ///   - resolver: resolve the address of the symbol, or return `nil` if not found
+    /// - Throws: ``FixupError``, or an error while reading the file
+    public func mapImage(
+        into buffer: UnsafeMutableRawBufferPointer,
+        baseAddress: UInt64,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        resolver: (FixupBindTarget) -> UInt64?
+    ) throws {
+        guard !isLoadedFromDyldCache else {
+            throw FixupError.loadedFromDyldCache
+        }
+        guard let preferredLoadAddress = _preferredLoadAddress,
+              let imageSize = mappedImageSize else {
+            throw FixupError.missingTextSegment
+        }
+        guard let image = buffer.baseAddress,
+              buffer.count >= imageSize else {
+            throw FixupError.bufferTooSmall(required: imageSize)
+        }
+
+        image.initializeMemory(as: UInt8.self, repeating: 0, count: imageSize)
+        for segment in _mappedSegments(preferredLoadAddress: preferredLoadAddress) {
+            let size = min(segment.fileSize, segment.virtualMemorySize)
+            guard size > 0 else { continue }
+            let slice = try fileHandle.fileSlice(
+                offset: headerStartOffset + segment.fileOffset,
+                length: size
+            )
+            image
+                .advanced(by: segment.virtualMemoryAddress - numericCast(preferredLoadAddress))
+                .copyMemory(from: slice.ptr, byteCount: size)
+        }
+
+        let applier = MachOFixupApplier(
+            image: image,
+            imageSize: imageSize,
+            baseAddress: baseAddress,
+            preferredLoadAddress: preferredLoadAddress,
+            is64Bit: is64Bit
+        )
+
+        if let chainedFixups = dyldChainedFixups,
+           let importTable = dyldChainedImportTable {
+            try applier.apply(
+                chainedFixups,
+                in: self,
+                bindTargets: try _chainedFixupBindTargets(
+                    of: importTable,
+                    resolver: resolver
+                ),
+                maxConcurrency: maxConcurrency
+            )
+        }
+
+        let segments = self.segments
+        try applier.apply(rebases, segments: segments)
+        for bindings in [bindingSymbols, lazyBindingSymbols] {
+            try applier.apply(
+                bindings,
+                segments: segments,
+                isWeakDefinition: false,
+                resolve: resolver
+            )
+        }
+        try applier.apply(
+            weakBindingSymbols,
+            segments: segments,
+            isWeakDefinition: true,
+            resolve: resolver
+        )
+    }
+}
+
+extension MachOFile {
+    /// vmaddr of `__TEXT`
+    private var _preferredLoadAddress: UInt64? {
+        if let text64 = loadCommands.text64 {
+            return text64.vmaddr
+        } else if let text = loadCommands.text {
+            return numericCast(text.vmaddr)
+        }
+        return nil
+    }
+
+    /// Segments mapped into memory, excluding `__PAGEZERO` below `__TEXT`
+    private func _mappedSegments(
+        preferredLoadAddress: UInt64
+    ) -> [any SegmentCommandProtocol] {
+        segments.filter {
+            $0.virtualMemorySize > 0 &&
+            $0.virtualMemoryAddress >= numericCast(preferredLoadAddress)
+        }
+    }
+
+    /// Resolved address of each import including its addend, `nil` for missing weak imports
+    ///
+    /// Weak imports whose symbol names cannot be read are treated as missing.
+    private func _chainedFixupBindTargets(
+        of importTable: DyldChainedImportTable,
+        resolver: (FixupBindTarget) -> UInt64?
+    ) throws -> [UInt64?] {
+        try importTable.entries.enumerated().map { ordinal, entry -> UInt64? in
+            guard let symbolName = entry.symbolName else {
+                guard entry.isWeakImport else {
+                    throw FixupError.invalidImportSymbolName(ordinal: ordinal)
+                }
+                return nil
+            }
+            let target = FixupBindTarget(
+                libraryOrdinal: entry.libraryOrdinal,
+                symbolName: symbolName,
+                isWeakImport: entry.isWeakImport
+            )
+            guard let address = resolver(target) else {
+                guard entry.isWeakImport else {
+                    throw FixupError.unresolvedSymbol(target)
+                }
+                return nil
+            }
+            return address &+ UInt64(bitPattern: Int64(entry.addend))
+        }
+    }
+}
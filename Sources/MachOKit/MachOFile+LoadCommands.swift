@@ -14,6 +14,26 @@ extension MachOFile {
         public let numberOfCommands: Int
         public let isSwapped: Bool
 
+        /// Decoded commands indexed by type
+        let _index: Index
+
+        init(
+            data: Data,
+            numberOfCommands: Int,
+            isSwapped: Bool
+        ) {
+            self.data = data
+            self.numberOfCommands = numberOfCommands
+            self.isSwapped = isSwapped
+            self._index = .init(
+                Iterator(
+                    data: data,
+                    numberOfCommands: numberOfCommands,
+                    isSwapped: isSwapped
+                )
+            )
+        }
+
         public func makeIterator() -> Iterator {
             Iterator(
                 data: data,
@@ -74,4 +94,144 @@ extension MachOFile.LoadCommands {
     }
 }
 
-extension MachOFile.LoadCommands: LoadCommandsProtocol {}
+extension MachOFile.LoadCommands: LoadCommandsProtocol {
+    public func of(_ type: LoadCommandType) -> AnySequence<LoadCommand> {
+        let commands = _index.commands
+        return AnySequence(
+            (_index.positionsByType[type] ?? []).lazy.map {
+                commands[$0]
+            }
+        )
+    }
+
+    public func infos<T>(
+        of type: @escaping (T) -> LoadCommand
+    ) -> AnySequence<T> {
+        let commands = _index.commands
+        return AnySequence(
+            _index.positions(forInfoType: T.self).lazy.compactMap {
+                let cmd = commands[$0]
+                guard let info = cmd.info as? T else { return nil }
+                guard type(info).type == cmd.type else { return nil }
+                return info
+            }
+        )
+    }
+
+    public func info<T>(
+        of type: @escaping (T) -> LoadCommand
+    ) -> T? {
+        for position in _index.positions(forInfoType: T.self) {
+            let cmd = _index.commands[position]
+            guard let info = cmd.info as? T,
+                  type(info).type == cmd.type else {
+                continue
+            }
+            return info
+        }
+        return nil
+    }
+}
+
+extension MachOFile.LoadCommands {
+    /// Decoded load commands indexed by command type and info type.
+    ///
+    /// Built once per ``MachOFile`` so that looking up a command by its type
+    /// does not decode and check every load command.
+    struct Index: Sendable {
+        let commands: [LoadCommand]
+        let positionsByType: [LoadCommandType: [Int]]
+        /// Positions keyed by `ObjectIdentifier` of the type of `LoadCommand.info`
+        let positionsByInfoType: [ObjectIdentifier: [Int]]
+
+        let text: SegmentCommand?
+        let text64: SegmentCommand64?
+        let linkedit: SegmentCommand?
+        let linkedit64: SegmentCommand64?
+
+        init(_ iterator: Iterator) {
+            var iterator = iterator
+            var commands: [LoadCommand] = []
+            var positionsByType: [LoadCommandType: [Int]] = [:]
+            var positionsByInfoType: [ObjectIdentifier: [Int]] = [:]
+            var text: SegmentCommand?
+            var text64: SegmentCommand64?
+            var linkedit: SegmentCommand?
+            var linkedit64: SegmentCommand64?
+
+            while let cmd = iterator.next() {
+                let position = commands.count
+                commands.append(cmd)
+                positionsByType[cmd.type, default: []].append(position)
+                positionsByInfoType[
+                    ObjectIdentifier(Swift.type(of: cmd.info)),
+                    default: []
+                ].append(position)
+
+                switch cmd {
+                case let .segment(segment):
+                    if text == nil, segment.segname == SEG_TEXT { text = segment }
+                    if linkedit == nil, segment.segname == SEG_LINKEDIT { linkedit = segment }
+                case let .segment64(segment):
+                    if text64 == nil, segment.segname == SEG_TEXT { text64 = segment }
+                    if linkedit64 == nil, segment.segname == SEG_LINKEDIT { linkedit64 = segment }
+                default:
+                    break
+                }
+            }
+
+            self.commands = commands
+            self.positionsByType = positionsByType
+            self.positionsByInfoType = positionsByInfoType
+            self.text = text
+            self.text64 = text64
+            self.linkedit = linkedit
+            self.linkedit64 = linkedit64
+        }
+    }
+}
+
+extension MachOFile.LoadCommands.Index {
+    /// Positions of commands whose info is of the specified type
+    func positions<T>(forInfoType type: T.Type) -> [Int] {
+        // `T` may be an existential, which never matches the dynamic type of info.
+        guard T.self is any LoadCommandWrapper.Type else {
+            return Array(commands.indices)
+        }
+        return positionsByInfoType[ObjectIdentifier(T.self)] ?? []
+    }
+}
+
+extension MachOFile.LoadCommands {
+    var text: SegmentCommand? {
+        _index.text
+    }
+
+    var text64: SegmentCommand64? {
+        _index.text64
+    }
+
+    var linkedit: SegmentCommand? {
+        _index.linkedit
+    }
+
+    var linkedit64: SegmentCommand64? {
+        _index.linkedit64
+    }
+
+    var symtab: LoadCommandInfo<symtab_command>? {
+        guard let position = _index.positionsByType[.symtab]?.first,
+              case let .symtab(command) = _index.commands[position] else {
+            return nil
+        }
+        return command
+    }
+
+    var dysymtab: LoadCommandInfo<dysymtab_command>? {
+        guard let position = _index.positionsByType[.dysymtab]?.first,
+              case let .dysymtab(command) = _index.commands[position] else {
+            return nil
+        }
+        return command
+    }
+}
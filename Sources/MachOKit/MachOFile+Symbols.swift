@@ -382,6 +382,18 @@ extension MachOFile.Symbols64: _SymbolTableProtocol {
         numericCast(nlist.layout.n_value)
     }
 
+    func stringOffset(of nlist: Nlist64) -> Int {
+        numericCast(nlist.layout.n_un.n_strx)
+    }
+
+    func nameC(of nlist: Nlist64) -> UnsafePointer<CChar>? {
+        let offset: Int = numericCast(nlist.layout.n_un.n_strx)
+        guard offset < stringsSlice.size else { return nil }
+        return stringsSlice.ptr
+            .advanced(by: offset)
+            .assumingMemoryBound(to: CChar.self)
+    }
+
     func symbol(at position: Int, nlist: Nlist64) -> MachOFile.Symbol {
         let string = stringsSlice.readString(
             offset: numericCast(nlist.layout.n_un.n_strx)
@@ -410,6 +422,18 @@ extension MachOFile.Symbols: _SymbolTableProtocol {
         numericCast(nlist.layout.n_value)
     }
 
+    func stringOffset(of nlist: Nlist) -> Int {
+        numericCast(nlist.layout.n_un.n_strx)
+    }
+
+    func nameC(of nlist: Nlist) -> UnsafePointer<CChar>? {
+        let offset: Int = numericCast(nlist.layout.n_un.n_strx)
+        guard offset < stringsSlice.size else { return nil }
+        return stringsSlice.ptr
+            .advanced(by: offset)
+            .assumingMemoryBound(to: CChar.self)
+    }
+
     func symbol(at position: Int, nlist: Nlist) -> MachOFile.Symbol {
         let string = stringsSlice.readString(
             offset: numericCast(nlist.layout.n_un.n_strx)
@@ -422,3 +446,204 @@ extension MachOFile.Symbols: _SymbolTableProtocol {
         )
     }
 }
+
+// MARK: - Borrowed
+
+extension MachOFile {
+    /// Symbol that refers to its name in the string table without copying it.
+    ///
+    /// Unlike ``Symbol``, no `String` is created and the nlist is stored without boxing.
+    /// The name is materialized only when ``name`` is accessed.
+    ///
+    /// - Warning: ``nameBytes`` points into the mapped file.
+    ///   Do not use it after the `MachOFile` is released.
+    public struct BorrowedSymbol<Nlist: NlistProtocol> {
+        /// Bytes of symbol name in the string table.
+        /// (null terminator is not included)
+        public let nameBytes: UnsafeBufferPointer<UInt8>
+
+        /// Offset from start of mach header (`MachO`)
+        /// File offset from mach header (`MachOFile`)
+        public let offset: Int
+
+        /// Nlist or Nlist64
+        public let nlist: Nlist
+    }
+}
+
+extension MachOFile.BorrowedSymbol {
+    /// Symbol name
+    public var name: String {
+        String(bytes: nameBytes, encoding: .utf8) ?? ""
+    }
+
+    /// Symbol with materialized name
+    public var symbol: MachOFile.Symbol {
+        .init(
+            name: name,
+            offset: offset,
+            nlist: nlist
+        )
+    }
+}
+
+extension MachOFile.Symbols64 {
+    /// Collection of symbols that refer to their names in the string table without copying.
+    public var borrowed: MachOFile.BorrowedSymbols64 {
+        .init(
+            stringsSlice: stringsSlice,
+            symbolsSlice: symbolsSlice,
+            numberOfSymbols: numberOfSymbols,
+            isSwapped: isSwapped
+        )
+    }
+}
+
+extension MachOFile.Symbols {
+    /// Collection of symbols that refer to their names in the string table without copying.
+    public var borrowed: MachOFile.BorrowedSymbols {
+        .init(
+            stringsSlice: stringsSlice,
+            symbolsSlice: symbolsSlice,
+            numberOfSymbols: numberOfSymbols,
+            isSwapped: isSwapped
+        )
+    }
+}
+
+extension MachOFile {
+    public struct BorrowedSymbols64: RandomAccessCollection {
+        typealias FileSlice = File.FileSlice
+
+        public typealias Element = BorrowedSymbol<Nlist64>
+        public typealias Index = Int
+
+        private let stringsSlice: FileSlice
+        private let symbolsSlice: FileSlice
+        public let numberOfSymbols: Int
+
+        let isSwapped: Bool
+
+        init(
+            stringsSlice: FileSlice,
+            symbolsSlice: FileSlice,
+            numberOfSymbols: Int,
+            isSwapped: Bool
+        ) {
+            self.stringsSlice = stringsSlice
+            self.symbolsSlice = symbolsSlice
+            self.numberOfSymbols = numberOfSymbols
+            self.isSwapped = isSwapped
+        }
+
+        public var startIndex: Index { 0 }
+        /// Empty if the symbol or string table is empty, like iterating ``MachOFile/Symbols64``.
+        public var endIndex: Index {
+            guard symbolsSlice.size != 0,
+                  stringsSlice.size != 0 else {
+                return 0
+            }
+            return min(numberOfSymbols, symbolsSlice.size / Nlist64.layoutSize)
+        }
+
+        public subscript(position: Int) -> Element {
+            precondition(
+                startIndex <= position && position < endIndex,
+                "Index out of range"
+            )
+            var symbol = symbolsSlice.ptr.loadUnaligned(
+                fromByteOffset: Nlist64.layoutSize * position,
+                as: nlist_64.self
+            )
+            if isSwapped {
+                swap_nlist_64(&symbol, 1, NXHostByteOrder())
+            }
+            return .init(
+                nameBytes: _nameBytes(
+                    in: stringsSlice,
+                    at: numericCast(symbol.n_un.n_strx)
+                ),
+                offset: numericCast(symbol.n_value),
+                nlist: Nlist64(layout: symbol)
+            )
+        }
+    }
+}
+
+extension MachOFile {
+    public struct BorrowedSymbols: RandomAccessCollection {
+        typealias FileSlice = File.FileSlice
+
+        public typealias Element = BorrowedSymbol<Nlist>
+        public typealias Index = Int
+
+        private let stringsSlice: FileSlice
+        private let symbolsSlice: FileSlice
+        public let numberOfSymbols: Int
+
+        let isSwapped: Bool
+
+        init(
+            stringsSlice: FileSlice,
+            symbolsSlice: FileSlice,
+            numberOfSymbols: Int,
+            isSwapped: Bool
+        ) {
+            self.stringsSlice = stringsSlice
+            self.symbolsSlice = symbolsSlice
+            self.numberOfSymbols = numberOfSymbols
+            self.isSwapped = isSwapped
+        }
+
+        public var startIndex: Index { 0 }
+        /// Empty if the symbol or string table is empty, like iterating ``MachOFile/Symbols``.
+        public var endIndex: Index {
+            guard symbolsSlice.size != 0,
+                  stringsSlice.size != 0 else {
+                return 0
+            }
+            return min(numberOfSymbols, symbolsSlice.size / Nlist.layoutSize)
+        }
+
+        public subscript(position: Int) -> Element {
+            precondition(
+                startIndex <= position && position < endIndex,
+                "Index out of range"
+            )
+            var symbol = symbolsSlice.ptr.loadUnaligned(
+                fromByteOffset: Nlist.layoutSize * position,
+                as: nlist.self
+            )
+            if isSwapped {
+                swap_nlist(&symbol, 1, NXHostByteOrder())
+            }
+            return .init(
+                nameBytes: _nameBytes(
+                    in: stringsSlice,
+                    at: numericCast(symbol.n_un.n_strx)
+                ),
+                offset: numericCast(symbol.n_value),
+                nlist: Nlist(layout: symbol)
+            )
+        }
+    }
+}
+
+@inline(__always)
+private func _nameBytes(
+    in stringsSlice: MachOFile.File.FileSlice,
+    at offset: Int
+) -> UnsafeBufferPointer<UInt8> {
+    guard 0 <= offset, offset < stringsSlice.size else {
+        return .init(start: nil, count: 0)
+    }
+    let start = stringsSlice.ptr.advanced(by: offset)
+    let length = strnlen(
+        start.assumingMemoryBound(to: CChar.self),
+        stringsSlice.size - offset
+    )
+    return .init(
+        start: start.assumingMemoryBound(to: UInt8.self),
+        count: length
+    )
+}
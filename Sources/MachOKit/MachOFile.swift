@@ -30,6 +30,26 @@ public class MachOFile: MachORepresentable {
     private var _fullCache: FullDyldCache?
     private var _cache: DyldCache?
 
+    // Load commands are decoded once and indexed by type
+    private var _loadCommands: LoadCommands?
+    private let _loadCommandsLock = NSLock()
+
+    // Lazily built symbol indices.
+    // `.some(nil)` once built for a file without symbols.
+    private var _symbolAddressIndex: SymbolAddressIndex??
+    private let _symbolAddressIndexLock = NSLock()
+    private var _symbolNameIndex: SymbolNameIndex??
+    private let _symbolNameIndexLock = NSLock()
+    private var _demangledNameCache: DemangledNameCache?
+    private let _demangledNameCacheLock = NSLock()
+
+    // Lazily built fixup indices, keyed by segment index
+    private var _dyldChainedFixupIndices: [Int: DyldChainedFixupIndex] = [:]
+    private let _dyldChainedFixupIndicesLock = NSLock()
+    // Lazily built import table of chained fixups
+    private var _dyldChainedImportTable: DyldChainedImportTable??
+    private let _dyldChainedImportTableLock = NSLock()
+
     /// A Boolean value that indicates whether the byte is swapped or not.
     ///
     /// True if the endianness of the currently running CPU is different from the endianness of the target MachO file.
@@ -54,16 +74,18 @@ public class MachOFile: MachORepresentable {
     }
 
     public var loadCommands: LoadCommands {
-        let data = try! fileHandle.readData(
-            offset: cmdsStartOffset,
-            length: numericCast(header.sizeofcmds)
-        )
+        _loadCommandsLock.lock()
+        defer { _loadCommandsLock.unlock() }
 
-        return .init(
-            data: data,
+        if let _loadCommands { return _loadCommands }
+
+        let loadCommands = LoadCommands(
+            data: _loadCommandsData(),
             numberOfCommands: numericCast(header.ncmds),
             isSwapped: isSwapped
         )
+        _loadCommands = loadCommands
+        return loadCommands
     }
 
     public convenience init(
@@ -142,6 +164,8 @@ public class MachOFile: MachORepresentable {
             for: fileHandle
         )
         self._cache = cache
+        // Keep the full cache alive, since shared wrappers only reference it weakly
+        self._fullCache = cache?._fullCache
 
         self.headerStartOffset = headerStartOffset
         self.headerStartOffsetInCache = headerStartOffsetInCache
@@ -278,6 +302,48 @@ extension MachOFile {
         return nil
     }
 
+    /// Sorted address index of symbols.
+    ///
+    /// It is built on first access and reused by subsequent lookups on this file.
+    /// See ``closestSymbol(at:inSection:isGlobalOnly:using:)``.
+    public var symbolAddressIndex: SymbolAddressIndex? {
+        _symbolAddressIndexLock.lock()
+        defer { _symbolAddressIndexLock.unlock() }
+
+        if let _symbolAddressIndex { return _symbolAddressIndex }
+        let index = makeSymbolAddressIndex()
+        _symbolAddressIndex = .some(index)
+        return index
+    }
+
+    /// Hash index of symbol names.
+    ///
+    /// It is built on first access and reused by subsequent lookups on this file.
+    /// See ``symbols(named:using:)``.
+    public var symbolNameIndex: SymbolNameIndex? {
+        _symbolNameIndexLock.lock()
+        defer { _symbolNameIndexLock.unlock() }
+
+        if let _symbolNameIndex { return _symbolNameIndex }
+        let index = makeSymbolNameIndex()
+        _symbolNameIndex = .some(index)
+        return index
+    }
+
+    /// Cache of demangled symbol names.
+    ///
+    /// It is created on first access and shared by subsequent lookups on this file.
+    /// See ``symbols(named:mangled:using:)``.
+    public var demangledNameCache: DemangledNameCache {
+        _demangledNameCacheLock.lock()
+        defer { _demangledNameCacheLock.unlock() }
+
+        if let _demangledNameCache { return _demangledNameCache }
+        let cache = DemangledNameCache()
+        _demangledNameCache = cache
+        return cache
+    }
+
     public typealias IndirectSymbols = DataSequence<IndirectSymbol>
 
     public var indirectSymbols: IndirectSymbols? {
@@ -539,6 +605,46 @@ extension MachOFile {
             isSwapped: isSwapped
         )
     }
+
+    /// Decoded import table of chained fixups, with interned symbol names.
+    ///
+    /// It is built on first access and reused afterwards.
+    public var dyldChainedImportTable: DyldChainedImportTable? {
+        _dyldChainedImportTableLock.lock()
+        defer { _dyldChainedImportTableLock.unlock() }
+        if let table = _dyldChainedImportTable {
+            return table
+        }
+        let table = dyldChainedFixups.map { DyldChainedImportTable($0) }
+        _dyldChainedImportTable = .some(table)
+        return table
+    }
+}
+
+extension MachOFile {
+    /// Cached fixup index of the segment, built with `build` on first access.
+    internal func _dyldChainedFixupIndex(
+        for segmentIndex: Int,
+        build: () -> DyldChainedFixupIndex?
+    ) -> DyldChainedFixupIndex? {
+        _dyldChainedFixupIndicesLock.lock()
+        if let index = _dyldChainedFixupIndices[segmentIndex] {
+            _dyldChainedFixupIndicesLock.unlock()
+            return index
+        }
+        _dyldChainedFixupIndicesLock.unlock()
+
+        // Build outside the lock, so that other segments are not blocked
+        guard let index = build() else { return nil }
+
+        _dyldChainedFixupIndicesLock.lock()
+        defer { _dyldChainedFixupIndicesLock.unlock() }
+        if let existing = _dyldChainedFixupIndices[segmentIndex] {
+            return existing
+        }
+        _dyldChainedFixupIndices[segmentIndex] = index
+        return index
+    }
 }
 
 extension MachOFile {
@@ -748,6 +854,31 @@ extension MachOFile {
     }
 }
 
+extension MachOFile {
+    /// Load commands region as a view over the mapped file, without copying.
+    ///
+    /// The file slice is retained until the returned data is released.
+    private func _loadCommandsData() -> Data {
+        let length: Int = numericCast(header.sizeofcmds)
+        guard let slice = try? fileHandle.fileSlice(
+            offset: cmdsStartOffset,
+            length: length
+        ) else {
+            return try! fileHandle.readData(
+                offset: cmdsStartOffset,
+                length: length
+            )
+        }
+        return Data(
+            bytesNoCopy: UnsafeMutableRawPointer(mutating: slice.ptr),
+            count: slice.size,
+            deallocator: .custom { _, _ in
+                withExtendedLifetime(slice) {}
+            }
+        )
+    }
+}
+
 extension MachOFile {
     internal func _fileSliceForLinkEditData(
         offset: Int, // linkedit_data_command->dataoff (linkedit.fileoff + x)
@@ -877,15 +1008,14 @@ extension MachOFile {
         )
 
         for segment in startsInSegments {
-            let pointers = chainedFixup.pointers(of: segment, in: self)
-            guard let pointer = pointers.first(where: {
-                $0.offset == offset
-            }) else { continue }
+            guard let pointer = chainedFixup.fixupIndex(of: segment, in: self)?
+                .pointer(for: offset) else { continue }
             guard pointer.fixupInfo.bind != nil,
-                  let (ordinal, addend) = pointer.bindOrdinalAndAddend(for: self) else {
+                  let (ordinal, addend) = pointer.bindOrdinalAndAddend(for: self),
+                  let entry = dyldChainedImportTable?.entry(at: ordinal) else {
                 return nil
             }
-            return (chainedFixup.imports[ordinal], addend)
+            return (entry.import, addend)
         }
         return nil
     }
@@ -178,3 +178,214 @@ extension MachOImage.DyldChainedFixups: DyldChainedFixupsProtocol {
         return String(cString: ptr)
     }
 }
+
+extension MachOImage.DyldChainedFixups {
+    /// Decoded import table with interned symbol names.
+    ///
+    /// The table is decoded on each call and is not cached, so keep it to reuse for lookups.
+    public func makeImportTable() -> DyldChainedImportTable {
+        .init(self)
+    }
+}
+
+extension MachOImage.DyldChainedFixups {
+    /// Call the closure with each fixup in the segment, read from the memory of `machO`.
+    ///
+    /// Valid only while the fixups of `machO` are not yet applied,
+    /// such as for an image mapped by the caller.
+    /// Nothing is visited for an image loaded by dyld, whose fixups are already applied.
+    /// Fixups are visited in page order, and in chain order within a page,
+    /// without collecting them into an array.
+    /// - Parameters:
+    ///   - startsInSegment: chain starts of the segment
+    ///   - machO: MachOImage to which `self` belongs
+    ///   - filter: kind of fixups to visit
+    ///   - body: closure called with each fixup. Set `stop` to true to end the traversal.
+    public func forEachPointer(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOImage,
+        filter: DyldChainedFixupPointerFilter = .all,
+        _ body: (_ pointer: DyldChainedFixupPointer, _ stop: inout Bool) throws -> Void
+    ) rethrows {
+        guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+            return
+        }
+        let segmentOffset: Int = numericCast(startsInSegment.segment_offset)
+
+        var stop = false
+        try walker.walk { offset, _, fixupInfo in
+            guard filter.matches(fixupInfo) else { return true }
+            try body(
+                DyldChainedFixupPointer(
+                    offset: segmentOffset + offset,
+                    fixupInfo: fixupInfo
+                ),
+                &stop
+            )
+            return !stop
+        }
+    }
+
+    /// Sorted index of fixups in the segment, read from the memory of `machO`.
+    ///
+    /// Valid only while the fixups of `machO` are not yet applied,
+    /// such as for an image mapped by the caller.
+    /// For an image loaded by dyld, the chains in memory are already overwritten
+    /// with the fixed-up pointers, so no index is built.
+    /// The index is not cached, so keep it to reuse for lookups.
+    /// - Parameters:
+    ///   - startsInSegment: chain starts of the segment
+    ///   - machO: MachOImage to which `self` belongs
+    /// - Returns: index of fixups, or `nil` if the pointer format is not supported
+    ///   or the fixups of `machO` are already applied
+    public func fixupIndex(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOImage
+    ) -> DyldChainedFixupIndex? {
+        guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+            return nil
+        }
+        return .init(
+            walker: walker,
+            segmentIndex: startsInSegment.segmentIndex,
+            segmentOffset: numericCast(startsInSegment.segment_offset)
+        )
+    }
+}
+
+extension MachOImage.DyldChainedFixups {
+    /// Fixups in the segment, decoded on multiple threads, read from the memory of `machO`.
+    ///
+    /// Pages are decoded concurrently and the fixups are returned sorted by offset,
+    /// regardless of `maxConcurrency` or scheduling.
+    /// For chains in ascending order, as linkers emit them,
+    /// the result equals the fixups visited by ``forEachPointer(of:in:filter:_:)``.
+    /// Valid only while the fixups of `machO` are not yet applied.
+    /// Empty for an image loaded by dyld.
+    /// - Parameters:
+    ///   - startsInSegment: chain starts of the segment
+    ///   - machO: MachOImage to which `self` belongs
+    ///   - filter: kind of fixups to decode
+    ///   - maxConcurrency: Maximum number of pages decoded concurrently
+    /// - Returns: fixups sorted by offset
+    public func concurrentPointers(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOImage,
+        filter: DyldChainedFixupPointerFilter = .all,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> [DyldChainedFixupPointer] {
+        guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+            return []
+        }
+        return DyldChainedFixupConcurrentDecoder.pointers(
+            of: [(walker, numericCast(startsInSegment.segment_offset))],
+            filter: filter,
+            maxConcurrency: maxConcurrency
+        )
+    }
+
+    /// Fixups in all segments, decoded on multiple threads, read from the memory of `machO`.
+    ///
+    /// Pages of all segments are decoded concurrently and the fixups are returned sorted by offset,
+    /// regardless of `maxConcurrency` or scheduling.
+    /// Empty for an image loaded by dyld, whose fixups are already applied.
+    /// - Parameters:
+    ///   - machO: MachOImage to which `self` belongs
+    ///   - filter: kind of fixups to decode
+    ///   - maxConcurrency: Maximum number of pages decoded concurrently
+    /// - Returns: fixups sorted by offset
+    public func concurrentPointers(
+        in machO: MachOImage,
+        filter: DyldChainedFixupPointerFilter = .all,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> [DyldChainedFixupPointer] {
+        guard let startsInImage, !machO._isLoadedByDyld else { return [] }
+        let segments = startsInSegments(of: startsInImage)
+            .compactMap { startsInSegment -> DyldChainedFixupConcurrentDecoder.Segment? in
+                guard let walker = _chainWalker(of: startsInSegment, in: machO) else {
+                    return nil
+                }
+                return (walker, numericCast(startsInSegment.segment_offset))
+            }
+        return DyldChainedFixupConcurrentDecoder.pointers(
+            of: segments,
+            filter: filter,
+            maxConcurrency: maxConcurrency
+        )
+    }
+}
+
+extension MachOImage.DyldChainedFixups {
+    internal func _chainWalker(
+        of startsInSegment: DyldChainedStartsInSegment,
+        in machO: MachOImage
+    ) -> DyldChainedFixupChainWalker? {
+        let pageCount: Int = numericCast(startsInSegment.page_count)
+        let pageSize: Int = numericCast(startsInSegment.page_size)
+        guard pageCount > 0, pageSize > 0,
+              let pointerFormat = startsInSegment.pointerFormat else {
+            return nil
+        }
+        // dyld rewrites chains in place with the fixed-up pointers
+        guard !machO._isLoadedByDyld else { return nil }
+
+        // `page_start` is followed by overflow entries of multi-start pages,
+        // up to the end of `dyld_chained_starts_in_segment`.
+        let pageStartOffset = startsInSegment.layoutOffset(of: \.page_start)
+        let pageStarts = UnsafeBufferPointer(
+            start: UnsafeRawPointer(basePointer)
+                .advanced(by: startsInSegment.offset + pageStartOffset)
+                .assumingMemoryBound(to: UInt16.self),
+            count: max(
+                pageCount,
+                (Int(startsInSegment.size) - pageStartOffset) / MemoryLayout<UInt16>.size
+            )
+        )
+        let segmentStart = machO.ptr
+            .advanced(by: numericCast(startsInSegment.segment_offset))
+        let segmentSize = pageCount * pageSize
+        let is64Bit = pointerFormat.is64Bit
+        let stride = is64Bit ? MemoryLayout<UInt64>.size : MemoryLayout<UInt32>.size
+
+        return .init(
+            startsInSegment: startsInSegment,
+            pageStart: { index in
+                guard pageStarts.indices.contains(index) else { return nil }
+                return pageStarts[index]
+            },
+            rawValue: { offset in
+                guard offset >= 0, offset + stride <= segmentSize else {
+                    return nil
+                }
+                if is64Bit {
+                    return segmentStart.loadUnaligned(
+                        fromByteOffset: offset,
+                        as: UInt64.self
+                    )
+                } else {
+                    return numericCast(
+                        segmentStart.loadUnaligned(
+                            fromByteOffset: offset,
+                            as: UInt32.self
+                        )
+                    )
+                }
+            }
+        )
+    }
+}
+
+extension MachOImage {
+    /// A boolean value that indicates whether the image is loaded by dyld,
+    /// that is, whether its fixups are already applied.
+    internal var _isLoadedByDyld: Bool {
+        #if canImport(Darwin)
+        let header = ptr
+        return (0..<_dyld_image_count()).contains { index in
+            _dyld_get_image_header(index).map(UnsafeRawPointer.init) == header
+        }
+        #else
+        return false
+        #endif
+    }
+}
@@ -54,6 +54,17 @@ extension MachOImage.ExportTrie {
         wrapped.exportedSymbols
     }
 
+    /// Visits all exported symbols from the trie tree one at a time
+    ///
+    /// The trie tree is walked depth-first without collecting all symbols,
+    /// and the traversal can be ended early by setting `stop` to true.
+    /// - Parameter body: Closure called with each exported symbol.
+    public func forEachExportedSymbol(
+        _ body: (_ symbol: ExportedSymbol, _ stop: inout Bool) throws -> Void
+    ) rethrows {
+        try wrapped.forEachExportedSymbol(body)
+    }
+
     /// Elements of each of the nodes that make up the trie tree
     ///
     /// It is obtained by traversing the nodes of the trie tree.It is obtained by traversing a trie tree.
@@ -69,6 +80,16 @@ extension MachOImage.ExportTrie {
         wrapped.search(by: key)
     }
 
+    /// Search the trie tree by multiple symbol names at once to get the expoted symbols
+    ///
+    /// The trie tree is walked once, and names sharing a prefix share the traversal.
+    /// Names sorted in ascending order are searched without sorting them again.
+    /// - Parameter keys: symbol names
+    /// - Returns: Exported symbol for each name, or nil if not found. In the same order as `keys`.
+    public func search(byKeys keys: [String]) -> [ExportedSymbol?] {
+        wrapped.search(byKeys: keys)
+    }
+
     /// Search the trie tree by prefix of symbol name to get the expoted symbol
     /// - Parameter prefix: prefix of symbol name
     /// - Returns: If found, retruns exported symbol
@@ -295,6 +295,15 @@ extension MachOImage.Symbols64: _SymbolTableProtocol {
         addressStart + numericCast(nlist.layout.n_value)
     }
 
+    func stringOffset(of nlist: Nlist64) -> Int {
+        numericCast(nlist.layout.n_un.n_strx)
+    }
+
+    func nameC(of nlist: Nlist64) -> UnsafePointer<CChar>? {
+        stringBase
+            .advanced(by: numericCast(nlist.layout.n_un.n_strx))
+    }
+
     func symbol(at position: Int, nlist: Nlist64) -> MachOImage.Symbol {
         let str = stringBase
             .advanced(by: numericCast(nlist.layout.n_un.n_strx))
@@ -317,6 +326,15 @@ extension MachOImage.Symbols: _SymbolTableProtocol {
         addressStart + numericCast(nlist.layout.n_value)
     }
 
+    func stringOffset(of nlist: Nlist) -> Int {
+        numericCast(nlist.layout.n_un.n_strx)
+    }
+
+    func nameC(of nlist: Nlist) -> UnsafePointer<CChar>? {
+        stringBase
+            .advanced(by: numericCast(nlist.layout.n_un.n_strx))
+    }
+
     func symbol(at position: Int, nlist: Nlist) -> MachOImage.Symbol {
         let str = stringBase
             .advanced(by: numericCast(nlist.layout.n_un.n_strx))
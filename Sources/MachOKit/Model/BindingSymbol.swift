@@ -15,6 +15,26 @@ public struct BindingSymbol: Sendable {
     public let segmentOffset: UInt
     public let addend: Int
     public let symbolName: String
+    /// `BIND_SYMBOL_FLAGS_WEAK_IMPORT` is set for the symbol
+    public let isWeakImport: Bool
+
+    init(
+        type: BindType,
+        libraryOrdinal: Int,
+        segmentIndex: UInt,
+        segmentOffset: UInt,
+        addend: Int,
+        symbolName: String,
+        isWeakImport: Bool = false
+    ) {
+        self.type = type
+        self.libraryOrdinal = libraryOrdinal
+        self.segmentIndex = segmentIndex
+        self.segmentOffset = segmentOffset
+        self.addend = addend
+        self.symbolName = symbolName
+        self.isWeakImport = isWeakImport
+    }
 }
 
 extension BindingSymbol {
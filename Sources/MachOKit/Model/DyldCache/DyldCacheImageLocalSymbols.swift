@@ -0,0 +1,71 @@
+//
+//  DyldCacheImageLocalSymbols.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Unmapped local symbols of an image in the dyld cache.
+public struct DyldCacheImageLocalSymbols {
+    /// Path of the image
+    public let imagePath: String
+    /// Local symbols entry of the image
+    public let entry: any DyldCacheLocalSymbolsEntryProtocol
+    /// Local symbols of the image
+    public let symbols: AnyRandomAccessCollection<MachOFile.Symbol>
+}
+
+extension DyldCacheLocalSymbolsInfo {
+    /// Local symbols of the specified images, reading the symbol table once.
+    ///
+    /// Images without an entry are skipped.
+    /// - Parameters:
+    ///   - images: Path, vmaddr of mach header and offset of mach header in its cache file
+    ///   - cache: DyldCache to which `self` belongs
+    ///   - index: Entry index built from `self`
+    ///   - sharedRegionStart: Shared region start of the main cache
+    internal func _imageLocalSymbols<Images: Sequence>(
+        for images: Images,
+        in cache: DyldCache,
+        using index: DyldCacheLocalSymbolsEntryIndex,
+        sharedRegionStart: UInt64
+    ) -> [DyldCacheImageLocalSymbols] where Images.Element == (imagePath: String, address: UInt64, headerOffset: UInt64) {
+        let symbols64 = symbols64(in: cache)
+        let symbols32 = symbols32(in: cache)
+
+        var results: [DyldCacheImageLocalSymbols] = []
+        for image in images {
+            // In the 64-bit entry format, `dylibOffset` is the VM offset of the __TEXT segment,
+            // which starts at the mach header for images in the cache.
+            let dylibOffset: Int = index.is64BitEntryFormat
+                ? numericCast(image.address) - numericCast(sharedRegionStart)
+                : numericCast(image.headerOffset)
+            guard let entry = index.entry(forDylibOffset: dylibOffset) else {
+                continue
+            }
+
+            let symbols: AnyRandomAccessCollection<MachOFile.Symbol>
+            if let symbols64 {
+                let range = entry.nlistRange.clamped(to: symbols64.indices)
+                symbols = AnyRandomAccessCollection(symbols64[range])
+            } else if let symbols32 {
+                let range = entry.nlistRange.clamped(to: symbols32.indices)
+                symbols = AnyRandomAccessCollection(symbols32[range])
+            } else {
+                symbols = AnyRandomAccessCollection([])
+            }
+
+            results.append(
+                .init(
+                    imagePath: image.imagePath,
+                    entry: entry,
+                    symbols: symbols
+                )
+            )
+        }
+        return results
+    }
+}
@@ -391,6 +391,10 @@ extension DyldCacheLocalSymbolsInfo {
         in cache: DyldCache
     ) -> DyldCacheLocalSymbolsEntry64? {
         guard let dylibOffset = dylibOffset(of: machO, in: cache) else { return nil }
+        if let index = cache.localSymbolsEntryIndex,
+           index.isBuilt(from: self) {
+            return index.entry64(forDylibOffset: numericCast(dylibOffset))
+        }
         return entries64(in: cache)?.first(
             where: {
                 $0.dylibOffset == dylibOffset
@@ -412,6 +416,10 @@ extension DyldCacheLocalSymbolsInfo {
         in cache: DyldCache
     ) -> DyldCacheLocalSymbolsEntry? {
         guard let dylibOffset = dylibOffset(of: machO, in: cache) else { return nil }
+        if let index = cache.localSymbolsEntryIndex,
+           index.isBuilt(from: self) {
+            return index.entry32(forDylibOffset: numericCast(dylibOffset))
+        }
         return entries32(in: cache)?.first(
             where: {
                 $0.dylibOffset == dylibOffset
@@ -433,6 +441,10 @@ extension DyldCacheLocalSymbolsInfo {
         in cache: DyldCache
     ) -> (any DyldCacheLocalSymbolsEntryProtocol)? {
         guard let dylibOffset = dylibOffset(of: machO, in: cache) else { return nil }
+        if let index = cache.localSymbolsEntryIndex,
+           index.isBuilt(from: self) {
+            return index.entry(forDylibOffset: numericCast(dylibOffset))
+        }
         return entries(in: cache).first(
             where: {
                 $0.dylibOffset == dylibOffset
@@ -457,6 +469,10 @@ extension DyldCacheLocalSymbolsInfo {
         in cache: FullDyldCache
     ) -> DyldCacheLocalSymbolsEntry64? {
         guard let dylibOffset = dylibOffset(of: machO, in: cache) else { return nil }
+        if let index = cache.localSymbolsEntryIndex,
+           index.isBuilt(from: self) {
+            return index.entry64(forDylibOffset: numericCast(dylibOffset))
+        }
         return entries64(in: cache)?.first(
             where: {
                 $0.dylibOffset == dylibOffset
@@ -479,6 +495,10 @@ extension DyldCacheLocalSymbolsInfo {
         in cache: FullDyldCache
     ) -> DyldCacheLocalSymbolsEntry? {
         guard let dylibOffset = dylibOffset(of: machO, in: cache) else { return nil }
+        if let index = cache.localSymbolsEntryIndex,
+           index.isBuilt(from: self) {
+            return index.entry32(forDylibOffset: numericCast(dylibOffset))
+        }
         return entries32(in: cache)?.first(
             where: {
                 $0.dylibOffset == dylibOffset
@@ -501,6 +521,10 @@ extension DyldCacheLocalSymbolsInfo {
         in cache: FullDyldCache
     ) -> (any DyldCacheLocalSymbolsEntryProtocol)? {
         guard let dylibOffset = dylibOffset(of: machO, in: cache) else { return nil }
+        if let index = cache.localSymbolsEntryIndex,
+           index.isBuilt(from: self) {
+            return index.entry(forDylibOffset: numericCast(dylibOffset))
+        }
         return entries(in: cache).first(
             where: {
                 $0.dylibOffset == dylibOffset
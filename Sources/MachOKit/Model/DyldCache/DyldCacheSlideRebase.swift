@@ -0,0 +1,84 @@
+//
+//  DyldCacheSlideRebase.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Pointer in the dyld cache rebased by slide info
+public struct DyldCacheSlideRebase: Sendable, Equatable {
+    /// File offset of the pointer
+    public let fileOffset: UInt64
+    /// Unslid vmaddr that the pointer points to
+    public let target: UInt64
+}
+
+/// Rebases of all pages in a mapping, decoded one page at a time.
+///
+/// Iterating over the sequence walks the delta chains of each page once,
+/// in page order and chain order within a page.
+public struct DyldCacheSlideRebases: Sequence {
+    /// Number of pages covered by the slide info
+    public let numberOfPages: Int
+
+    private let decodePage: (Int, inout [DyldCacheSlideRebase]) -> Void
+
+    init(
+        numberOfPages: Int,
+        decodePage: @escaping (Int, inout [DyldCacheSlideRebase]) -> Void
+    ) {
+        self.numberOfPages = numberOfPages
+        self.decodePage = decodePage
+    }
+
+    /// Rebases in the specified page of the mapping
+    /// - Parameter pageIndex: index of page in the mapping
+    /// - Returns: rebases in chain order
+    public func rebases(inPage pageIndex: Int) -> [DyldCacheSlideRebase] {
+        guard 0 <= pageIndex, pageIndex < numberOfPages else { return [] }
+        var rebases: [DyldCacheSlideRebase] = []
+        decodePage(pageIndex, &rebases)
+        return rebases
+    }
+
+    public func makeIterator() -> Iterator {
+        .init(numberOfPages: numberOfPages, decodePage: decodePage)
+    }
+}
+
+extension DyldCacheSlideRebases {
+    public struct Iterator: IteratorProtocol {
+        public typealias Element = DyldCacheSlideRebase
+
+        private let numberOfPages: Int
+        private let decodePage: (Int, inout [DyldCacheSlideRebase]) -> Void
+
+        private var nextPageIndex: Int = 0
+        /// Rebases of the current page, reused across pages
+        private var buffer: [DyldCacheSlideRebase] = []
+        private var position: Int = 0
+
+        init(
+            numberOfPages: Int,
+            decodePage: @escaping (Int, inout [DyldCacheSlideRebase]) -> Void
+        ) {
+            self.numberOfPages = numberOfPages
+            self.decodePage = decodePage
+        }
+
+        public mutating func next() -> DyldCacheSlideRebase? {
+            while position == buffer.count {
+                guard nextPageIndex < numberOfPages else { return nil }
+                buffer.removeAll(keepingCapacity: true)
+                position = 0
+                decodePage(nextPageIndex, &buffer)
+                nextPageIndex += 1
+            }
+            defer { position += 1 }
+            return buffer[position]
+        }
+    }
+}
@@ -0,0 +1,188 @@
+//
+//  ObjCObjectHashTable.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Precomputed perfect hash table of classes or protocols (`objc::ObjectHashTable`)
+///
+/// Lookups by name read a constant number of entries of the table,
+/// regardless of the number of objects.
+/// A name implemented by more than one image has all its objects in the duplicates list.
+public struct ObjCObjectHashTable: LayoutWrapper, Sendable {
+    public typealias Layout = objc_string_hash_table
+
+    public var layout: Layout
+    /// offset from start address of main cache
+    public let offset: Int
+}
+
+extension ObjCObjectHashTable {
+    public struct Object: Sendable, Equatable {
+        /// Name of class or protocol
+        public let name: String
+        /// Offset of the class or protocol from start address of main cache
+        public let offset: Int
+        /// Index of the header info ro of the image that defines the object
+        public let imageIndex: Int
+    }
+}
+
+extension ObjCObjectHashTable {
+    /// Find the objects with the name.
+    /// - Parameters:
+    ///   - name: class or protocol name
+    ///   - cache: DyldCache to which `self` belongs
+    /// - Returns: objects with the name, including all duplicates. Empty if the name is not in the table.
+    public func objects(
+        named name: String,
+        in cache: DyldCache
+    ) -> [Object] {
+        _reader(in: cache).map { objects(named: name, reader: $0) } ?? []
+    }
+
+    /// Find the objects with the name.
+    /// - Parameters:
+    ///   - name: class or protocol name
+    ///   - cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: objects with the name, including all duplicates. Empty if the name is not in the table.
+    public func objects(
+        named name: String,
+        in cache: DyldCacheLoaded
+    ) -> [Object] {
+        objects(named: name, reader: _reader(in: cache))
+    }
+
+    /// Find the objects with the name.
+    /// - Parameters:
+    ///   - name: class or protocol name
+    ///   - cache: FullDyldCache to which `self` belongs
+    /// - Returns: objects with the name, including all duplicates. Empty if the name is not in the table.
+    public func objects(
+        named name: String,
+        in cache: FullDyldCache
+    ) -> [Object] {
+        _reader(in: cache).map { objects(named: name, reader: $0) } ?? []
+    }
+}
+
+extension ObjCObjectHashTable {
+    /// Sequence of all objects, read one slot at a time in slot order.
+    ///
+    /// Duplicates of a name follow each other.
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: objects
+    public func objects(
+        in cache: DyldCache
+    ) -> AnySequence<Object>? {
+        _reader(in: cache).map { objects(reader: $0) }
+    }
+
+    /// Sequence of all objects, read one slot at a time in slot order.
+    ///
+    /// Duplicates of a name follow each other.
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: objects
+    public func objects(
+        in cache: DyldCacheLoaded
+    ) -> AnySequence<Object> {
+        objects(reader: _reader(in: cache))
+    }
+
+    /// Sequence of all objects, read one slot at a time in slot order.
+    ///
+    /// Duplicates of a name follow each other.
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: objects
+    public func objects(
+        in cache: FullDyldCache
+    ) -> AnySequence<Object>? {
+        _reader(in: cache).map { objects(reader: $0) }
+    }
+}
+
+extension ObjCObjectHashTable {
+    internal func _reader<Cache: _DyldCacheFileRepresentable>(
+        in cache: Cache
+    ) -> _ObjCHashTableReader<_ObjCHashTableFileSource<Cache>>? {
+        let address = cache.mainCacheHeader.sharedRegionStart + numericCast(offset)
+        guard let fileOffset = cache.fileOffset(of: address) else {
+            return nil
+        }
+        return .init(
+            layout: layout,
+            source: .init(cache: cache, address: address, fileOffset: fileOffset)
+        )
+    }
+
+    internal func _reader(
+        in cache: DyldCacheLoaded
+    ) -> _ObjCHashTableReader<_ObjCHashTableMemorySource> {
+        .init(
+            layout: layout,
+            source: .init(basePointer: cache.ptr.advanced(by: offset))
+        )
+    }
+
+    private func objects<Source: _ObjCHashTableSource>(
+        named name: String,
+        reader: _ObjCHashTableReader<Source>
+    ) -> [Object] {
+        guard let index = reader.index(of: name) else { return [] }
+        return objects(at: index, name: name, reader: reader)
+    }
+
+    private func objects<Source: _ObjCHashTableSource>(
+        reader: _ObjCHashTableReader<Source>
+    ) -> AnySequence<Object> {
+        AnySequence(
+            (0 ..< reader.capacity).lazy.flatMap { index -> [Object] in
+                guard let name = reader.name(at: index),
+                      !name.isEmpty else {
+                    return []
+                }
+                return objects(at: index, name: name, reader: reader)
+            }
+        )
+    }
+
+    // ObjectData: isDuplicate:1, objectCacheOffset:47, dylibObjCIndex:16
+    // If isDuplicate, objectCacheOffset is the start index in duplicates list
+    // and dylibObjCIndex is the number of duplicates.
+    private func objects<Source: _ObjCHashTableSource>(
+        at index: Int,
+        name: String,
+        reader: _ObjCHashTableReader<Source>
+    ) -> [Object] {
+        let data = reader.objectData(at: index)
+        let isDuplicate = data & 1 != 0
+        let objectCacheOffset = Int((data >> 1) & (1 << 47 - 1))
+        let dylibObjCIndex = Int(data >> 48)
+
+        guard isDuplicate else {
+            return [
+                .init(
+                    name: name,
+                    offset: objectCacheOffset,
+                    imageIndex: dylibObjCIndex
+                )
+            ]
+        }
+
+        let start = objectCacheOffset
+        let end = min(start + dylibObjCIndex, reader.duplicateCount)
+        guard start < end else { return [] }
+        return (start ..< end).map { duplicateIndex -> Object in
+            let data = reader.duplicateData(at: duplicateIndex)
+            return .init(
+                name: name,
+                offset: Int((data >> 1) & (1 << 47 - 1)),
+                imageIndex: Int(data >> 48)
+            )
+        }
+    }
+}
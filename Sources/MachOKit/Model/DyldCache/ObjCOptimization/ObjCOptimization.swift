@@ -289,3 +289,132 @@ extension ObjCOptimization {
         )
     }
 }
+
+// MARK: Hash Tables
+// https://github.com/apple-oss-distributions/dyld/blob/65bbeed63cec73f313b1d636e63f243964725a9d/common/ObjCStringTable.h
+extension ObjCOptimization {
+    /// Perfect hash table of selectors
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: selector hash table
+    public func selectorHashTable(
+        in cache: DyldCache
+    ) -> ObjCStringHashTable? {
+        _hashTable(at: layout.selectorHashTableCacheOffset, in: cache)
+            .map { ObjCStringHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of classes
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: class hash table
+    public func classHashTable(
+        in cache: DyldCache
+    ) -> ObjCObjectHashTable? {
+        _hashTable(at: layout.classHashTableCacheOffset, in: cache)
+            .map { ObjCObjectHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of protocols
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: protocol hash table
+    public func protocolHashTable(
+        in cache: DyldCache
+    ) -> ObjCObjectHashTable? {
+        _hashTable(at: layout.protocolHashTableCacheOffset, in: cache)
+            .map { ObjCObjectHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of selectors
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: selector hash table
+    public func selectorHashTable(
+        in cache: FullDyldCache
+    ) -> ObjCStringHashTable? {
+        _hashTable(at: layout.selectorHashTableCacheOffset, in: cache)
+            .map { ObjCStringHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of classes
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: class hash table
+    public func classHashTable(
+        in cache: FullDyldCache
+    ) -> ObjCObjectHashTable? {
+        _hashTable(at: layout.classHashTableCacheOffset, in: cache)
+            .map { ObjCObjectHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of protocols
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: protocol hash table
+    public func protocolHashTable(
+        in cache: FullDyldCache
+    ) -> ObjCObjectHashTable? {
+        _hashTable(at: layout.protocolHashTableCacheOffset, in: cache)
+            .map { ObjCObjectHashTable(layout: $0.0, offset: $0.1) }
+    }
+}
+
+extension ObjCOptimization {
+    internal func _hashTable<Cache: _DyldCacheFileRepresentable>(
+        at cacheOffset: UInt64,
+        in cache: Cache
+    ) -> (objc_string_hash_table, Int)? {
+        guard cacheOffset > 0 else {
+            return nil
+        }
+        let sharedRegionStart = cache.mainCacheHeader.sharedRegionStart
+        guard let resolvedOffset = cache.fileOffset(
+            of: sharedRegionStart + cacheOffset
+        ) else {
+            return nil
+        }
+        let layout: objc_string_hash_table = cache.fileHandle.read(offset: resolvedOffset)
+        return (layout, numericCast(cacheOffset))
+    }
+}
+
+extension ObjCOptimization {
+    /// Perfect hash table of selectors
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: selector hash table
+    public func selectorHashTable(
+        in cache: DyldCacheLoaded
+    ) -> ObjCStringHashTable? {
+        _hashTable(at: layout.selectorHashTableCacheOffset, in: cache)
+            .map { ObjCStringHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of classes
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: class hash table
+    public func classHashTable(
+        in cache: DyldCacheLoaded
+    ) -> ObjCObjectHashTable? {
+        _hashTable(at: layout.classHashTableCacheOffset, in: cache)
+            .map { ObjCObjectHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    /// Perfect hash table of protocols
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: protocol hash table
+    public func protocolHashTable(
+        in cache: DyldCacheLoaded
+    ) -> ObjCObjectHashTable? {
+        _hashTable(at: layout.protocolHashTableCacheOffset, in: cache)
+            .map { ObjCObjectHashTable(layout: $0.0, offset: $0.1) }
+    }
+
+    private func _hashTable(
+        at cacheOffset: UInt64,
+        in cache: DyldCacheLoaded
+    ) -> (objc_string_hash_table, Int)? {
+        guard cacheOffset > 0 else {
+            return nil
+        }
+        let offset: Int = numericCast(cacheOffset)
+        let layout: objc_string_hash_table = cache.ptr
+            .advanced(by: offset)
+            .autoBoundPointee()
+        return (layout, offset)
+    }
+}
@@ -0,0 +1,148 @@
+//
+//  ObjCStringHashTable.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Precomputed perfect hash table of selectors (`objc::SelectorHashTable`)
+///
+/// Lookups by name read a constant number of entries of the table,
+/// regardless of the number of selectors.
+public struct ObjCStringHashTable: LayoutWrapper, Sendable {
+    public typealias Layout = objc_string_hash_table
+
+    public var layout: Layout
+    /// offset from start address of main cache
+    public let offset: Int
+}
+
+extension ObjCStringHashTable {
+    public struct Entry: Sendable, Equatable {
+        /// String of entry
+        public let name: String
+        /// Offset of the string from start address of main cache
+        public let offset: Int
+    }
+}
+
+extension ObjCStringHashTable {
+    /// Find the entry with the name.
+    /// - Parameters:
+    ///   - name: selector name
+    ///   - cache: DyldCache to which `self` belongs
+    /// - Returns: entry, or `nil` if the name is not in the table
+    public func entry(
+        named name: String,
+        in cache: DyldCache
+    ) -> Entry? {
+        _reader(in: cache).flatMap { entry(named: name, reader: $0) }
+    }
+
+    /// Find the entry with the name.
+    /// - Parameters:
+    ///   - name: selector name
+    ///   - cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: entry, or `nil` if the name is not in the table
+    public func entry(
+        named name: String,
+        in cache: DyldCacheLoaded
+    ) -> Entry? {
+        entry(named: name, reader: _reader(in: cache))
+    }
+
+    /// Find the entry with the name.
+    /// - Parameters:
+    ///   - name: selector name
+    ///   - cache: FullDyldCache to which `self` belongs
+    /// - Returns: entry, or `nil` if the name is not in the table
+    public func entry(
+        named name: String,
+        in cache: FullDyldCache
+    ) -> Entry? {
+        _reader(in: cache).flatMap { entry(named: name, reader: $0) }
+    }
+}
+
+extension ObjCStringHashTable {
+    /// Sequence of all entries, read one slot at a time in slot order
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: entries
+    public func entries(
+        in cache: DyldCache
+    ) -> AnySequence<Entry>? {
+        _reader(in: cache).map { entries(reader: $0) }
+    }
+
+    /// Sequence of all entries, read one slot at a time in slot order
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: entries
+    public func entries(
+        in cache: DyldCacheLoaded
+    ) -> AnySequence<Entry> {
+        entries(reader: _reader(in: cache))
+    }
+
+    /// Sequence of all entries, read one slot at a time in slot order
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: entries
+    public func entries(
+        in cache: FullDyldCache
+    ) -> AnySequence<Entry>? {
+        _reader(in: cache).map { entries(reader: $0) }
+    }
+}
+
+extension ObjCStringHashTable {
+    internal func _reader<Cache: _DyldCacheFileRepresentable>(
+        in cache: Cache
+    ) -> _ObjCHashTableReader<_ObjCHashTableFileSource<Cache>>? {
+        let address = cache.mainCacheHeader.sharedRegionStart + numericCast(offset)
+        guard let fileOffset = cache.fileOffset(of: address) else {
+            return nil
+        }
+        return .init(
+            layout: layout,
+            source: .init(cache: cache, address: address, fileOffset: fileOffset)
+        )
+    }
+
+    internal func _reader(
+        in cache: DyldCacheLoaded
+    ) -> _ObjCHashTableReader<_ObjCHashTableMemorySource> {
+        .init(
+            layout: layout,
+            source: .init(basePointer: cache.ptr.advanced(by: offset))
+        )
+    }
+
+    private func entry<Source: _ObjCHashTableSource>(
+        named name: String,
+        reader: _ObjCHashTableReader<Source>
+    ) -> Entry? {
+        guard let index = reader.index(of: name),
+              let target = reader.target(at: index) else {
+            return nil
+        }
+        return .init(name: name, offset: offset + target)
+    }
+
+    private func entries<Source: _ObjCHashTableSource>(
+        reader: _ObjCHashTableReader<Source>
+    ) -> AnySequence<Entry> {
+        let offset = offset
+        return AnySequence(
+            (0 ..< reader.capacity).lazy.compactMap { index -> Entry? in
+                guard let target = reader.target(at: index),
+                      let name = reader.source.string(at: target),
+                      !name.isEmpty else {
+                    return nil
+                }
+                return .init(name: name, offset: offset + target)
+            }
+        )
+    }
+}
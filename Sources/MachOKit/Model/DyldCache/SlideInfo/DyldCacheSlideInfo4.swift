@@ -104,3 +104,29 @@ extension DyldCacheSlideInfo4 {
         )
     }
 }
+
+extension DyldCacheSlideInfo4 {
+    /// Value of the specified pointer in a delta chain, with the chain bits removed
+    ///
+    /// Small positive and negative values are non-pointers and are used as is.
+    /// Other values are rebased by adding `value_add`.
+    ///
+    /// [dyld implementation](https://github.com/apple-oss-distributions/dyld/blob/66c652a1f1f6b7b5266b8bbfd51cb0965d67cc44/common/DyldSharedCache.cpp)
+    /// - Parameter rawValue: raw value in the chain
+    /// - Returns: unslid target if `isRebase`, otherwise the non-pointer value
+    internal func _resolve(
+        rawValue: UInt32
+    ) -> (value: UInt64, isRebase: Bool) {
+        let deltaMask = UInt32(truncatingIfNeeded: layout.delta_mask)
+        let value = rawValue & ~deltaMask
+        if (value & 0xFFFF8000) == 0 {
+            // small positive non-pointer
+            return (numericCast(value), false)
+        } else if (value & 0x3FFF8000) == 0x3FFF8000 {
+            // small negative non-pointer
+            return (numericCast(value | 0xC0000000), false)
+        } else {
+            return (numericCast(value) + layout.value_add, true)
+        }
+    }
+}
@@ -27,3 +27,169 @@ extension SwiftOptimization {
         }
     }
 }
+
+// MARK: Protocol Conformance Hash Tables
+// https://github.com/apple-oss-distributions/dyld/blob/031f1c6ffb240a094f3f2f85f20dfd9e3f15b664/common/OptimizerSwift.h
+extension SwiftOptimization {
+    /// Hash table of conformances keyed by type descriptor and protocol
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: conformance hash table
+    public func typeConformanceHashTable(
+        in cache: DyldCache
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.typeConformanceHashTableCacheOffset,
+            kind: .type,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by metadata and protocol
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: conformance hash table
+    public func metadataConformanceHashTable(
+        in cache: DyldCache
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.metadataConformanceHashTableCacheOffset,
+            kind: .metadata,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by name of foreign type and protocol
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: conformance hash table
+    public func foreignTypeConformanceHashTable(
+        in cache: DyldCache
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.foreignTypeConformanceHashTableCacheOffset,
+            kind: .foreignType,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by type descriptor and protocol
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: conformance hash table
+    public func typeConformanceHashTable(
+        in cache: FullDyldCache
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.typeConformanceHashTableCacheOffset,
+            kind: .type,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by metadata and protocol
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: conformance hash table
+    public func metadataConformanceHashTable(
+        in cache: FullDyldCache
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.metadataConformanceHashTableCacheOffset,
+            kind: .metadata,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by name of foreign type and protocol
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: conformance hash table
+    public func foreignTypeConformanceHashTable(
+        in cache: FullDyldCache
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.foreignTypeConformanceHashTableCacheOffset,
+            kind: .foreignType,
+            in: cache
+        )
+    }
+}
+
+extension SwiftOptimization {
+    internal func _conformanceHashTable<Cache: _DyldCacheFileRepresentable>(
+        at cacheOffset: UInt64,
+        kind: SwiftProtocolConformanceHashTable.Kind,
+        in cache: Cache
+    ) -> SwiftProtocolConformanceHashTable? {
+        guard cacheOffset > 0 else {
+            return nil
+        }
+        let sharedRegionStart = cache.mainCacheHeader.sharedRegionStart
+        guard let resolvedOffset = cache.fileOffset(
+            of: sharedRegionStart + cacheOffset
+        ) else {
+            return nil
+        }
+        let layout: SwiftProtocolConformanceHashTable.Layout = cache.fileHandle.read(offset: resolvedOffset)
+        return .init(
+            layout: layout,
+            offset: numericCast(cacheOffset),
+            kind: kind
+        )
+    }
+}
+
+extension SwiftOptimization {
+    /// Hash table of conformances keyed by type descriptor and protocol
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: conformance hash table
+    public func typeConformanceHashTable(
+        in cache: DyldCacheLoaded
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.typeConformanceHashTableCacheOffset,
+            kind: .type,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by metadata and protocol
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: conformance hash table
+    public func metadataConformanceHashTable(
+        in cache: DyldCacheLoaded
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.metadataConformanceHashTableCacheOffset,
+            kind: .metadata,
+            in: cache
+        )
+    }
+
+    /// Hash table of conformances keyed by name of foreign type and protocol
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: conformance hash table
+    public func foreignTypeConformanceHashTable(
+        in cache: DyldCacheLoaded
+    ) -> SwiftProtocolConformanceHashTable? {
+        _conformanceHashTable(
+            at: layout.foreignTypeConformanceHashTableCacheOffset,
+            kind: .foreignType,
+            in: cache
+        )
+    }
+
+    private func _conformanceHashTable(
+        at cacheOffset: UInt64,
+        kind: SwiftProtocolConformanceHashTable.Kind,
+        in cache: DyldCacheLoaded
+    ) -> SwiftProtocolConformanceHashTable? {
+        guard cacheOffset > 0 else {
+            return nil
+        }
+        let offset: Int = numericCast(cacheOffset)
+        let layout: SwiftProtocolConformanceHashTable.Layout = cache.ptr
+            .advanced(by: offset)
+            .autoBoundPointee()
+        return .init(
+            layout: layout,
+            offset: offset,
+            kind: kind
+        )
+    }
+}
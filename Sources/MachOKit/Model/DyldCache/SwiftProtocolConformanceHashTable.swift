@@ -0,0 +1,357 @@
+//
+//  SwiftProtocolConformanceHashTable.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Precomputed perfect hash table of swift protocol conformances
+///
+/// Conformances of a pair of conforming type and protocol are found
+/// by reading a constant number of entries of the table.
+///
+/// https://github.com/apple-oss-distributions/dyld/blob/031f1c6ffb240a094f3f2f85f20dfd9e3f15b664/common/OptimizerSwift.h
+public struct SwiftProtocolConformanceHashTable: LayoutWrapper, Sendable {
+    public typealias Layout = swift_hash_table
+
+    public enum Kind: Sendable {
+        /// keyed by type descriptor and protocol
+        case type
+        /// keyed by metadata and protocol
+        case metadata
+        /// keyed by name of foreign type descriptor and protocol
+        case foreignType
+    }
+
+    public var layout: Layout
+    /// offset from start address of main cache
+    public let offset: Int
+    /// Kind of conforming types in the table
+    public let kind: Kind
+}
+
+extension SwiftProtocolConformanceHashTable {
+    public enum ConformingType: Sendable, Hashable {
+        /// Type descriptor, as offset from start address of main cache
+        case typeDescriptor(offset: Int)
+        /// Metadata, as offset from start address of main cache
+        case metadata(offset: Int)
+        /// Name of foreign type descriptor, as offset from start address of main cache
+        case foreignTypeName(offset: Int, length: Int)
+    }
+
+    public struct Conformance: Sendable, Equatable {
+        /// Conforming type
+        public let conformingType: ConformingType
+        /// Offset of the protocol descriptor from start address of main cache
+        public let protocolOffset: Int
+        /// Offset of the protocol conformance descriptor from start address of main cache
+        public let conformanceOffset: Int
+        /// Index of the header info ro of the image that defines the conformance
+        public let imageIndex: Int
+    }
+}
+
+extension SwiftProtocolConformanceHashTable {
+    /// Find conformances of the type to the protocol.
+    ///
+    /// Not available for ``Kind/foreignType`` table, whose keys are names.
+    /// - Parameters:
+    ///   - conformingTypeOffset: offset of type descriptor or metadata from start address of main cache
+    ///   - protocolOffset: offset of protocol descriptor from start address of main cache
+    ///   - cache: DyldCache to which `self` belongs
+    /// - Returns: conformances. Empty if the pair is not in the table.
+    public func conformances(
+        conformingTypeOffset: Int,
+        protocolOffset: Int,
+        in cache: DyldCache
+    ) -> [Conformance] {
+        _reader(in: cache).map {
+            conformances(
+                conformingTypeOffset: conformingTypeOffset,
+                protocolOffset: protocolOffset,
+                reader: $0
+            )
+        } ?? []
+    }
+
+    /// Find conformances of the type to the protocol.
+    ///
+    /// Not available for ``Kind/foreignType`` table, whose keys are names.
+    /// - Parameters:
+    ///   - conformingTypeOffset: offset of type descriptor or metadata from start address of main cache
+    ///   - protocolOffset: offset of protocol descriptor from start address of main cache
+    ///   - cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: conformances. Empty if the pair is not in the table.
+    public func conformances(
+        conformingTypeOffset: Int,
+        protocolOffset: Int,
+        in cache: DyldCacheLoaded
+    ) -> [Conformance] {
+        conformances(
+            conformingTypeOffset: conformingTypeOffset,
+            protocolOffset: protocolOffset,
+            reader: _reader(in: cache)
+        )
+    }
+
+    /// Find conformances of the type to the protocol.
+    ///
+    /// Not available for ``Kind/foreignType`` table, whose keys are names.
+    /// - Parameters:
+    ///   - conformingTypeOffset: offset of type descriptor or metadata from start address of main cache
+    ///   - protocolOffset: offset of protocol descriptor from start address of main cache
+    ///   - cache: FullDyldCache to which `self` belongs
+    /// - Returns: conformances. Empty if the pair is not in the table.
+    public func conformances(
+        conformingTypeOffset: Int,
+        protocolOffset: Int,
+        in cache: FullDyldCache
+    ) -> [Conformance] {
+        _reader(in: cache).map {
+            conformances(
+                conformingTypeOffset: conformingTypeOffset,
+                protocolOffset: protocolOffset,
+                reader: $0
+            )
+        } ?? []
+    }
+}
+
+extension SwiftProtocolConformanceHashTable {
+    /// Sequence of all conformances, read one slot at a time in slot order.
+    ///
+    /// Conformances with the same key follow each other.
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: conformances
+    public func conformances(
+        in cache: DyldCache
+    ) -> AnySequence<Conformance>? {
+        _reader(in: cache).map { conformances(reader: $0) }
+    }
+
+    /// Sequence of all conformances, read one slot at a time in slot order.
+    ///
+    /// Conformances with the same key follow each other.
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: conformances
+    public func conformances(
+        in cache: DyldCacheLoaded
+    ) -> AnySequence<Conformance> {
+        conformances(reader: _reader(in: cache))
+    }
+
+    /// Sequence of all conformances, read one slot at a time in slot order.
+    ///
+    /// Conformances with the same key follow each other.
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: conformances
+    public func conformances(
+        in cache: FullDyldCache
+    ) -> AnySequence<Conformance>? {
+        _reader(in: cache).map { conformances(reader: $0) }
+    }
+}
+
+extension SwiftProtocolConformanceHashTable {
+    /// All conformances grouped by conforming type.
+    ///
+    /// The table is read once, so that conformances of any type are then found
+    /// without knowing its protocols.
+    /// - Parameter cache: DyldCache to which `self` belongs
+    /// - Returns: conformances for each conforming type
+    public func conformancesByConformingType(
+        in cache: DyldCache
+    ) -> [ConformingType: [Conformance]] {
+        guard let all = conformances(in: cache) else { return [:] }
+        return Dictionary(grouping: all, by: \.conformingType)
+    }
+
+    /// All conformances grouped by conforming type.
+    ///
+    /// The table is read once, so that conformances of any type are then found
+    /// without knowing its protocols.
+    /// - Parameter cache: DyldCacheLoaded to which `self` belongs
+    /// - Returns: conformances for each conforming type
+    public func conformancesByConformingType(
+        in cache: DyldCacheLoaded
+    ) -> [ConformingType: [Conformance]] {
+        Dictionary(grouping: conformances(in: cache), by: \.conformingType)
+    }
+
+    /// All conformances grouped by conforming type.
+    ///
+    /// The table is read once, so that conformances of any type are then found
+    /// without knowing its protocols.
+    /// - Parameter cache: FullDyldCache to which `self` belongs
+    /// - Returns: conformances for each conforming type
+    public func conformancesByConformingType(
+        in cache: FullDyldCache
+    ) -> [ConformingType: [Conformance]] {
+        guard let all = conformances(in: cache) else { return [:] }
+        return Dictionary(grouping: all, by: \.conformingType)
+    }
+}
+
+extension SwiftProtocolConformanceHashTable {
+    internal func _reader<Cache: _DyldCacheFileRepresentable>(
+        in cache: Cache
+    ) -> _ObjCHashTableReader<_ObjCHashTableFileSource<Cache>>? {
+        let address = cache.mainCacheHeader.sharedRegionStart + numericCast(offset)
+        guard let fileOffset = cache.fileOffset(of: address) else {
+            return nil
+        }
+        return .init(
+            layout: layout,
+            source: .init(cache: cache, address: address, fileOffset: fileOffset)
+        )
+    }
+
+    internal func _reader(
+        in cache: DyldCacheLoaded
+    ) -> _ObjCHashTableReader<_ObjCHashTableMemorySource> {
+        .init(
+            layout: layout,
+            source: .init(basePointer: cache.ptr.advanced(by: offset))
+        )
+    }
+
+    private func conformances<Source: _ObjCHashTableSource>(
+        conformingTypeOffset: Int,
+        protocolOffset: Int,
+        reader: _ObjCHashTableReader<Source>
+    ) -> [Conformance] {
+        guard kind != .foreignType else { return [] }
+
+        // Key is `{ uint64_t conformingTypeCacheOffset; uint64_t protocolCacheOffset; }`
+        let key: [UInt64] = [
+            UInt64(truncatingIfNeeded: conformingTypeOffset).littleEndian,
+            UInt64(truncatingIfNeeded: protocolOffset).littleEndian
+        ]
+        let hash = key.withUnsafeBytes {
+            ObjCPerfectHash.lookup8($0, level: layout.salt)
+        }
+        guard let index = reader.index(forHash: hash),
+              let target = reader.target(at: index) else {
+            return []
+        }
+
+        let conformances = conformances(at: target, reader: reader)
+        // Any key hashes to some slot, so compare the key with the slot
+        guard let first = conformances.first,
+              first.protocolOffset == protocolOffset else {
+            return []
+        }
+        switch first.conformingType {
+        case let .typeDescriptor(offset), let .metadata(offset):
+            guard offset == conformingTypeOffset else { return [] }
+        case .foreignTypeName:
+            return []
+        }
+        return conformances
+    }
+
+    private func conformances<Source: _ObjCHashTableSource>(
+        reader: _ObjCHashTableReader<Source>
+    ) -> AnySequence<Conformance> {
+        AnySequence(
+            (0 ..< reader.capacity).lazy.flatMap { index -> [Conformance] in
+                guard let target = reader.target(at: index) else {
+                    return []
+                }
+                return conformances(at: target, reader: reader)
+            }
+        )
+    }
+
+    /// Conformances stored from the target, following `nextIsDuplicate`
+    private func conformances<Source: _ObjCHashTableSource>(
+        at target: Int,
+        reader: _ObjCHashTableReader<Source>
+    ) -> [Conformance] {
+        var conformances: [Conformance] = []
+        var offset = target
+        while true {
+            let (entry, nextIsDuplicate, size) = conformance(at: offset, reader: reader)
+            conformances.append(entry)
+            guard nextIsDuplicate else { break }
+            offset += size
+        }
+        return conformances
+    }
+
+    private func conformance<Source: _ObjCHashTableSource>(
+        at offset: Int,
+        reader: _ObjCHashTableReader<Source>
+    ) -> (Conformance, nextIsDuplicate: Bool, size: Int) {
+        switch kind {
+        case .type:
+            let location = reader.source.read(
+                at: offset,
+                as: swift_type_protocol_conformance_location.self
+            )
+            return (
+                Conformance(
+                    location.location,
+                    conformingType: .typeDescriptor(
+                        offset: numericCast(location.typeDescriptorCacheOffset)
+                    ),
+                    protocolOffset: numericCast(location.protocolCacheOffset)
+                ),
+                location.location.nextIsDuplicate != 0,
+                MemoryLayout<swift_type_protocol_conformance_location>.size
+            )
+        case .metadata:
+            let location = reader.source.read(
+                at: offset,
+                as: swift_metadata_protocol_conformance_location.self
+            )
+            return (
+                Conformance(
+                    location.location,
+                    conformingType: .metadata(
+                        offset: numericCast(location.metadataCacheOffset)
+                    ),
+                    protocolOffset: numericCast(location.protocolCacheOffset)
+                ),
+                location.location.nextIsDuplicate != 0,
+                MemoryLayout<swift_metadata_protocol_conformance_location>.size
+            )
+        case .foreignType:
+            let location = reader.source.read(
+                at: offset,
+                as: swift_foreign_type_protocol_conformance_location.self
+            )
+            return (
+                Conformance(
+                    location.location,
+                    conformingType: .foreignTypeName(
+                        offset: numericCast(location.foreignDescriptorNameCacheOffset),
+                        length: numericCast(location.foreignDescriptorNameLength)
+                    ),
+                    protocolOffset: numericCast(location.protocolCacheOffset)
+                ),
+                location.location.nextIsDuplicate != 0,
+                MemoryLayout<swift_foreign_type_protocol_conformance_location>.size
+            )
+        }
+    }
+}
+
+extension SwiftProtocolConformanceHashTable.Conformance {
+    init(
+        _ location: swift_protocol_conformance_location,
+        conformingType: SwiftProtocolConformanceHashTable.ConformingType,
+        protocolOffset: Int
+    ) {
+        self.init(
+            conformingType: conformingType,
+            protocolOffset: protocolOffset,
+            conformanceOffset: numericCast(location.protocolConformanceCacheOffset),
+            imageIndex: numericCast(location.dylibObjCIndex)
+        )
+    }
+}
@@ -143,6 +143,10 @@ extension DyldChainedFixupPointer {
     public func bindOrdinalAndAddend(
         for machO: MachOFile  // swiftlint:disable:this unused_parameter
     ) -> (ordinal: Int, addend: UInt64)? {
+        _bindOrdinalAndAddend()
+    }
+
+    internal func _bindOrdinalAndAddend() -> (ordinal: Int, addend: UInt64)? {
         guard let bind = fixupInfo.bind else {
             return nil
         }
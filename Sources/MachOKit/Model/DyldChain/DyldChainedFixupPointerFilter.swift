@@ -0,0 +1,30 @@
+//
+//  DyldChainedFixupPointerFilter.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Kind of fixups to visit while walking fixup chains
+public enum DyldChainedFixupPointerFilter: Sendable {
+    /// rebases and binds
+    case all
+    /// rebases only
+    case rebase
+    /// binds only
+    case bind
+}
+
+extension DyldChainedFixupPointerFilter {
+    @inline(__always)
+    func matches(_ fixupInfo: DyldChainedFixupPointerInfo) -> Bool {
+        switch self {
+        case .all: return true
+        case .rebase: return fixupInfo.rebase != nil
+        case .bind: return fixupInfo.bind != nil
+        }
+    }
+}
@@ -41,6 +41,48 @@ public enum DyldChainedFixupPointerInfo: Sendable {
     case arm64e_segmented(ARM64ESegmented)
 }
 
+extension DyldChainedFixupPointerInfo {
+    /// Decode the raw value of a fixup in the pointer format.
+    ///
+    /// For 32-bit formats, only the lower 32 bits of `rawValue` are used.
+    /// Returns `nil` for formats whose chains are not supported.
+    init?(
+        rawValue: UInt64,
+        pointerFormat: DyldChainedFixupPointerFormat
+    ) {
+        switch pointerFormat {
+        case .arm64e:
+            self = .arm64e(.init(rawValue: rawValue))
+        case .arm64e_kernel:
+            self = .arm64e_kernel(.init(rawValue: rawValue))
+        case .arm64e_userland:
+            self = .arm64e_userland(.init(rawValue: rawValue))
+        case .arm64e_firmware:
+            self = .arm64e_firmware(.init(rawValue: rawValue))
+        case .arm64e_userland24:
+            self = .arm64e_userland24(.init(rawValue: rawValue))
+        case ._64:
+            self = ._64(.init(rawValue: rawValue))
+        case ._64_offset:
+            self = ._64_offset(.init(rawValue: rawValue))
+        case ._64_kernel_cache:
+            self = ._64_kernel_cache(.init(rawValue: rawValue))
+        case .x86_64_kernel_cache:
+            self = .x86_64_kernel_cache(.init(rawValue: rawValue))
+        case .arm64e_shared_cache:
+            self = .arm64e_shared_cache(.init(rawValue: rawValue))
+        case ._32:
+            self = ._32(.init(rawValue: UInt32(truncatingIfNeeded: rawValue)))
+        case ._32_cache:
+            self = ._32_cache(.init(rawValue: UInt32(truncatingIfNeeded: rawValue)))
+        case ._32_firmware:
+            self = ._32_firmware(.init(rawValue: UInt32(truncatingIfNeeded: rawValue)))
+        case .arm64e_segmented:
+            return nil
+        }
+    }
+}
+
 extension DyldChainedFixupPointerInfo {
     public var pointerFormat: DyldChainedFixupPointerFormat {
         switch self {
@@ -0,0 +1,108 @@
+//
+//  DyldChainedImportTable.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Decoded import table of chained fixups.
+///
+/// Imports are decoded and byte-swapped once,
+/// and their symbol names are interned so that imports with the same name share one string.
+/// Accessing an import by ordinal does not allocate.
+public struct DyldChainedImportTable: Sendable {
+    public struct Entry: Sendable {
+        /// Decoded import
+        public let `import`: DyldChainedImport
+        /// Library ordinal of the import
+        public let libraryOrdinal: Int
+        /// Symbol name of the import, or `nil` if it cannot be read
+        public let symbolName: String?
+        /// Addend of the import
+        public let addend: Int
+        /// A Boolean value that indicates whether the symbol may be missing at runtime.
+        public let isWeakImport: Bool
+    }
+
+    /// Target of a bind fixup
+    public struct Bind: Sendable {
+        /// Import ordinal of the bind
+        public let ordinal: Int
+        /// Library ordinal of the import
+        public let libraryOrdinal: Int
+        /// Symbol name of the import, or `nil` if it cannot be read
+        public let symbolName: String?
+        /// Sum of the addends of the fixup and the import
+        public let addend: UInt64
+        /// A Boolean value that indicates whether the symbol may be missing at runtime.
+        public let isWeakImport: Bool
+    }
+
+    /// Entries in import ordinal order
+    public let entries: [Entry]
+
+    /// Number of imports
+    public var count: Int {
+        entries.count
+    }
+}
+
+extension DyldChainedImportTable {
+    init<Fixups: DyldChainedFixupsProtocol>(_ chainedFixups: Fixups) {
+        var names: [Int: String?] = [:]
+        entries = chainedFixups.imports.map { `import` -> Entry in
+            let info = `import`.info
+            let symbolName: String?
+            if let name = names[info.nameOffset] {
+                symbolName = name
+            } else {
+                symbolName = chainedFixups.symbolName(for: info.nameOffset)
+                names[info.nameOffset] = .some(symbolName)
+            }
+            return .init(
+                import: `import`,
+                libraryOrdinal: info.libraryOrdinal,
+                symbolName: symbolName,
+                addend: info.addend,
+                isWeakImport: info.isWeakImport
+            )
+        }
+    }
+}
+
+extension DyldChainedImportTable {
+    /// Import at the ordinal.
+    /// - Parameter ordinal: import ordinal of bind fixups
+    /// - Returns: import, or `nil` if the ordinal is out of range
+    public func entry(at ordinal: Int) -> Entry? {
+        guard entries.indices.contains(ordinal) else { return nil }
+        return entries[ordinal]
+    }
+
+    /// Symbol name of the import at the ordinal.
+    /// - Parameter ordinal: import ordinal of bind fixups
+    /// - Returns: symbol name, or `nil` if the ordinal is out of range or the name cannot be read
+    public func symbolName(at ordinal: Int) -> String? {
+        entry(at: ordinal)?.symbolName
+    }
+
+    /// Target of the bind fixup.
+    /// - Parameter pointer: bind fixup
+    /// - Returns: target of the bind, or `nil` if `pointer` is not a bind or its ordinal is out of range
+    public func bind(for pointer: DyldChainedFixupPointer) -> Bind? {
+        guard let (ordinal, addend) = pointer._bindOrdinalAndAddend(),
+              let entry = entry(at: ordinal) else {
+            return nil
+        }
+        return .init(
+            ordinal: ordinal,
+            libraryOrdinal: entry.libraryOrdinal,
+            symbolName: entry.symbolName,
+            addend: addend &+ UInt64(bitPattern: Int64(entry.addend)),
+            isWeakImport: entry.isWeakImport
+        )
+    }
+}
@@ -0,0 +1,29 @@
+//
+//  FixupBindTarget.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Symbol to be resolved for binds, passed to the resolver of
+/// ``MachOFile/mapImage(into:baseAddress:maxConcurrency:resolver:)``.
+public struct FixupBindTarget: Sendable, Hashable {
+    /// Library ordinal of the symbol.
+    ///
+    /// 1-based index of dependencies, or special value such as `BIND_SPECIAL_DYLIB_SELF`.
+    /// ``BindSpecial`` can be used to interpret special values.
+    public let libraryOrdinal: Int
+    /// Name of the symbol
+    public let symbolName: String
+    /// A Boolean value that indicates whether the symbol may be missing at runtime.
+    public let isWeakImport: Bool
+}
+
+extension FixupBindTarget {
+    public var bindSpecial: BindSpecial? {
+        .init(rawValue: BindSpecial.RawValue(libraryOrdinal))
+    }
+}
@@ -0,0 +1,33 @@
+//
+//  FixupError.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Errors that can occur while mapping an image and applying its fixups.
+public enum FixupError: LocalizedError, Sendable {
+    /// Images in dyld shared cache are already fixed up by the cache builder
+    case loadedFromDyldCache
+    /// The image has no `__TEXT` segment to determine its preferred load address
+    case missingTextSegment
+    /// The buffer is smaller than the mapped image
+    case bufferTooSmall(required: Int)
+    /// Pointer format of chained fixups is unknown
+    case unknownPointerFormat(rawValue: UInt16)
+    /// Chained fixups of the pointer format cannot be applied
+    case unsupportedPointerFormat(DyldChainedFixupPointerFormat)
+    /// Rebases of the type cannot be applied
+    case unsupportedRebaseType(RebaseType)
+    /// A fixup is located outside of the mapped image
+    case invalidFixupLocation(offset: Int)
+    /// A bind refers to an import that does not exist
+    case invalidImportOrdinal(Int)
+    /// The symbol name of an import that is not weakly imported cannot be read
+    case invalidImportSymbolName(ordinal: Int)
+    /// The resolver could not resolve a symbol that is not weakly imported
+    case unresolvedSymbol(FixupBindTarget)
+}
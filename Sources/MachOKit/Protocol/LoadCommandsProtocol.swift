@@ -8,10 +8,42 @@
 
 import Foundation
 
-public protocol LoadCommandsProtocol: Sequence<LoadCommand> {}
+public protocol LoadCommandsProtocol: Sequence<LoadCommand> {
+    /// Load commands of the specified type
+    func of(_ type: LoadCommandType) -> AnySequence<LoadCommand>
+
+    /// Infos of load commands of the specified type
+    func infos<T>(
+        of type: @escaping (T) -> LoadCommand
+    ) -> AnySequence<T>
+
+    /// Info of the first load command of the specified type
+    func info<T>(
+        of type: @escaping (T) -> LoadCommand
+    ) -> T?
+}
 
 extension LoadCommandsProtocol {
     public func of(_ type: LoadCommandType) -> AnySequence<LoadCommand> {
+        _of(type)
+    }
+
+    public func infos<T>(
+        of type: @escaping (T) -> LoadCommand
+    ) -> AnySequence<T> {
+        _infos(of: type)
+    }
+
+    public func info<T>(
+        of type: @escaping (T) -> LoadCommand
+    ) -> T? {
+        infos(of: type)
+            .first(where: { _ in true })
+    }
+}
+
+extension LoadCommandsProtocol {
+    func _of(_ type: LoadCommandType) -> AnySequence<LoadCommand> {
         AnySequence(
             lazy.filter {
                 $0.type == type
@@ -19,7 +51,7 @@ extension LoadCommandsProtocol {
         )
     }
 
-    public func infos<T>(
+    func _infos<T>(
         of type: @escaping (T) -> LoadCommand
     ) -> AnySequence<T> {
         AnySequence(
@@ -30,13 +62,6 @@ extension LoadCommandsProtocol {
             }
         )
     }
-
-    public func info<T>(
-        of type: @escaping (T) -> LoadCommand
-    ) -> T? {
-        infos(of: type)
-            .first(where: { _ in true })
-    }
 }
 
 extension LoadCommandsProtocol {
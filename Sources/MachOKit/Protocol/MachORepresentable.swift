@@ -481,6 +481,330 @@ extension MachORepresentable where Self == MachOImage {
     }
 }
 
+extension MachORepresentable where Self == MachOFile {
+    /// Find the symbols closest to each of the specified offsets.
+    ///
+    /// Queries are sorted and resolved in a single sweep over the sorted symbols,
+    /// so the symbol table is read only once regardless of the number of offsets.
+    /// Each result is the same symbol as ``closestSymbol(at:inSection:isGlobalOnly:)``.
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - offsets: Offsets from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    /// - Returns: Closest symbols, in the same order as `offsets`.
+    public func closestSymbols(
+        forOffsets offsets: [Int],
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false
+    ) -> [Symbol?] {
+        if is64Bit, let symbols64 {
+            return _closestSymbols(
+                in: self,
+                forOffsets: offsets,
+                inSection: sectionNumber,
+                isGlobalOnly: isGlobalOnly,
+                symbols: symbols64
+            )
+        } else if let symbols32 {
+            return _closestSymbols(
+                in: self,
+                forOffsets: offsets,
+                inSection: sectionNumber,
+                isGlobalOnly: isGlobalOnly,
+                symbols: symbols32
+            )
+        }
+        return .init(repeating: nil, count: offsets.count)
+    }
+}
+
+extension MachORepresentable where Self == MachOImage {
+    /// Find the symbols closest to each of the specified offsets.
+    ///
+    /// Queries are sorted and resolved in a single sweep over the sorted symbols,
+    /// so the symbol table is read only once regardless of the number of offsets.
+    /// Each result is the same symbol as ``closestSymbol(at:inSection:isGlobalOnly:)``.
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - offsets: Offsets from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    /// - Returns: Closest symbols, in the same order as `offsets`.
+    public func closestSymbols(
+        forOffsets offsets: [Int],
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false
+    ) -> [Symbol?] {
+        if is64Bit, let symbols64 {
+            return _closestSymbols(
+                in: self,
+                forOffsets: offsets,
+                inSection: sectionNumber,
+                isGlobalOnly: isGlobalOnly,
+                symbols: symbols64
+            )
+        } else if let symbols32 {
+            return _closestSymbols(
+                in: self,
+                forOffsets: offsets,
+                inSection: sectionNumber,
+                isGlobalOnly: isGlobalOnly,
+                symbols: symbols32
+            )
+        }
+        return .init(repeating: nil, count: offsets.count)
+    }
+}
+
+extension MachORepresentable where Self == MachOFile {
+    /// Build a sorted address index of symbols.
+    ///
+    /// Use ``MachOFile/symbolAddressIndex`` to get an index that is built once and reused.
+    /// - Returns: Built index, or nil if there is no symbol table.
+    public func makeSymbolAddressIndex() -> SymbolAddressIndex? {
+        if is64Bit, let symbols64 {
+            return .init(machO: self, symbols: symbols64)
+        } else if let symbols32 {
+            return .init(machO: self, symbols: symbols32)
+        }
+        return nil
+    }
+
+    /// Find the symbol closest to the address at the specified offset using a prebuilt index.
+    ///
+    /// Returns the same symbol as ``closestSymbol(at:inSection:isGlobalOnly:)``.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Closest symbol.
+    public func closestSymbol(
+        at offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> Symbol? {
+        guard let symbolIndex = index.closestSymbolIndex(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly
+        ) else { return nil }
+        return _symbol(atIndex: symbolIndex)
+    }
+
+    /// Find the symbols closest to the address at the specified offset using a prebuilt index.
+    ///
+    /// Returns the same symbols as ``closestSymbols(at:inSection:isGlobalOnly:)``.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Closest symbols.
+    public func closestSymbols(
+        at offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> [Symbol] {
+        index.closestSymbolIndices(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly
+        ).compactMap {
+            _symbol(atIndex: $0)
+        }
+    }
+
+    /// Find the symbol matching the specified offset using a prebuilt index.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Matched symbol
+    public func symbol(
+        for offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> Symbol? {
+        let best = closestSymbol(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            using: index
+        )
+        return best?.offset == offset ? best : nil
+    }
+
+    /// Find the symbols matching the specified offset using a prebuilt index.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Matched symbols
+    public func symbols(
+        for offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> [Symbol] {
+        let best = closestSymbols(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            using: index
+        )
+        return best.first?.offset == offset ? best : []
+    }
+
+    @inline(__always)
+    private func _symbol(atIndex index: Int) -> Symbol? {
+        if is64Bit, let symbols64 {
+            guard symbols64.indices.contains(index) else { return nil }
+            return symbols64[index]
+        } else if let symbols32 {
+            guard symbols32.indices.contains(index) else { return nil }
+            return symbols32[index]
+        }
+        return nil
+    }
+}
+
+extension MachORepresentable where Self == MachOImage {
+    /// Build a sorted address index of symbols.
+    ///
+    /// Since `MachOImage` does not hold any state, keep the returned index to reuse it.
+    /// - Returns: Built index, or nil if there is no symbol table.
+    public func makeSymbolAddressIndex() -> SymbolAddressIndex? {
+        if is64Bit, let symbols64 {
+            return .init(machO: self, symbols: symbols64)
+        } else if let symbols32 {
+            return .init(machO: self, symbols: symbols32)
+        }
+        return nil
+    }
+
+    /// Find the symbol closest to the address at the specified offset using a prebuilt index.
+    ///
+    /// Returns the same symbol as ``closestSymbol(at:inSection:isGlobalOnly:)``.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Closest symbol.
+    public func closestSymbol(
+        at offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> Symbol? {
+        guard let symbolIndex = index.closestSymbolIndex(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly
+        ) else { return nil }
+        return _symbol(atIndex: symbolIndex)
+    }
+
+    /// Find the symbols closest to the address at the specified offset using a prebuilt index.
+    ///
+    /// Returns the same symbols as ``closestSymbols(at:inSection:isGlobalOnly:)``.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Closest symbols.
+    public func closestSymbols(
+        at offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> [Symbol] {
+        index.closestSymbolIndices(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly
+        ).compactMap {
+            _symbol(atIndex: $0)
+        }
+    }
+
+    /// Find the symbol matching the specified offset using a prebuilt index.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Matched symbol
+    public func symbol(
+        for offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> Symbol? {
+        let best = closestSymbol(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            using: index
+        )
+        return best?.offset == offset ? best : nil
+    }
+
+    /// Find the symbols matching the specified offset using a prebuilt index.
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Address index built from this mach-o.
+    /// - Returns: Matched symbols
+    public func symbols(
+        for offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolAddressIndex
+    ) -> [Symbol] {
+        let best = closestSymbols(
+            at: offset,
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            using: index
+        )
+        return best.first?.offset == offset ? best : []
+    }
+
+    @inline(__always)
+    private func _symbol(atIndex index: Int) -> Symbol? {
+        if is64Bit, let symbols64 {
+            guard symbols64.indices.contains(index) else { return nil }
+            return symbols64[index]
+        } else if let symbols32 {
+            guard symbols32.indices.contains(index) else { return nil }
+            return symbols32[index]
+        }
+        return nil
+    }
+}
+
 // ref: https://github.com/apple-oss-distributions/dyld/blob/93bd81f9d7fcf004fcebcb66ec78983882b41e71/common/MachOLoaded.cpp#L606
 @inline(__always)
 private func _closestSymbol<MachO, Table>( // swiftlint:disable:this cyclomatic_complexity
@@ -629,18 +953,130 @@ private func _closestSymbols<MachO, Table>( // swiftlint:disable:this cyclomatic
         }
     } else {
         for i in symbols.indices {
-            updateBestSymbols(
+            updateBestSymbols(
+                at: i,
+                nlist: symbols.wrappedNlist(at: i),
+                requireNonStab: true,
+                requireExternal: isGlobalOnly
+            )
+        }
+    }
+
+    return bestIndices.map {
+        symbols.symbol(at: $0, nlist: symbols.wrappedNlist(at: $0))
+    }
+}
+
+// Batch version of `_closestSymbol`.
+// Candidates are sorted by (offset, rank) so that the first candidate at each offset
+// is the one `_closestSymbol` would choose.
+@inline(__always)
+private func _closestSymbols<MachO, Table>( // swiftlint:disable:this cyclomatic_complexity
+    in machO: MachO,
+    forOffsets offsets: [Int],
+    inSection sectionNumber: Int,
+    isGlobalOnly: Bool,
+    symbols: Table
+) -> [MachO.Symbol?] where MachO: MachORepresentable, Table: _SymbolTableProtocol<MachO.Symbol> {
+    typealias Candidate = (offset: Int, isLocal: Bool, index: Int)
+
+    var candidates: [Candidate] = []
+
+    func appendCandidate(
+        at index: Int,
+        nlist: Table.WrappedNlist,
+        isLocal: Bool,
+        requireNonStab: Bool,
+        requireExternal: Bool
+    ) {
+        let flags = nlist.flags ?? .init(rawValue: 0)
+        guard flags.type == .sect,
+              !requireNonStab || flags.stab == nil,
+              !requireExternal || flags.contains(.ext),
+              sectionNumber == 0 || nlist.sectionNumber == sectionNumber else {
+            return
+        }
+        candidates.append(
+            (symbols.offset(of: nlist), isLocal, index)
+        )
+    }
+
+    if let dysym = machO.loadCommands.dysymtab {
+        let globalStart: Int = numericCast(dysym.iextdefsym)
+        let globalCount: Int = numericCast(dysym.nextdefsym)
+        for i in (globalStart ..< globalStart + globalCount).clamped(to: symbols.indices) {
+            appendCandidate(
+                at: i,
+                nlist: symbols.wrappedNlist(at: i),
+                isLocal: false,
+                requireNonStab: false,
+                requireExternal: false
+            )
+        }
+        if !isGlobalOnly {
+            let localStart: Int = numericCast(dysym.ilocalsym)
+            let localCount: Int = numericCast(dysym.nlocalsym)
+            for i in (localStart ..< localStart + localCount).clamped(to: symbols.indices) {
+                // locals only win if they are strictly closer than globals
+                appendCandidate(
+                    at: i,
+                    nlist: symbols.wrappedNlist(at: i),
+                    isLocal: true,
+                    requireNonStab: true,
+                    requireExternal: false
+                )
+            }
+        }
+    } else {
+        for i in symbols.indices {
+            appendCandidate(
                 at: i,
                 nlist: symbols.wrappedNlist(at: i),
+                isLocal: false,
                 requireNonStab: true,
                 requireExternal: isGlobalOnly
             )
         }
     }
 
-    return bestIndices.map {
-        symbols.symbol(at: $0, nlist: symbols.wrappedNlist(at: $0))
+    var results = [MachO.Symbol?](repeating: nil, count: offsets.count)
+    guard !candidates.isEmpty else { return results }
+
+    candidates.sort {
+        ($0.offset, $0.isLocal ? 1 : 0, $0.index) < ($1.offset, $1.isLocal ? 1 : 0, $1.index)
+    }
+    let order = offsets.indices.sorted { offsets[$0] < offsets[$1] }
+
+    var position = 0
+    var best: Candidate?
+    var resolved: (index: Int, symbol: MachO.Symbol)?
+
+    for queryIndex in order {
+        let offset = offsets[queryIndex]
+        while position < candidates.count,
+              candidates[position].offset <= offset {
+            let candidate = candidates[position]
+            // keep the first candidate at each offset
+            if best?.offset != candidate.offset {
+                best = candidate
+            }
+            position += 1
+        }
+        guard let bestIndex = best?.index else { continue }
+
+        if let resolved, resolved.index == bestIndex {
+            results[queryIndex] = resolved.symbol
+            continue
+        }
+        let symbol = symbols.symbol(
+            at: bestIndex,
+            nlist: symbols.wrappedNlist(at: bestIndex)
+        )
+        resolved = (bestIndex, symbol)
+        results[queryIndex] = symbol
     }
+
+    return results
 }
 
 extension MachORepresentable {
@@ -809,6 +1245,425 @@ extension MachORepresentable {
     }
 }
 
+extension MachORepresentable where Self == MachOFile {
+    /// Build a hash index of symbol names.
+    ///
+    /// Use ``MachOFile/symbolNameIndex`` to get an index that is built once and reused.
+    /// - Returns: Built index, or nil if there is no symbol table.
+    public func makeSymbolNameIndex() -> SymbolNameIndex? {
+        if is64Bit, let symbols64 {
+            return .init(symbols: symbols64)
+        } else if let symbols32 {
+            return .init(symbols: symbols32)
+        }
+        return nil
+    }
+
+    /// Find the symbols matching the given name using a prebuilt index.
+    ///
+    /// Returns the same symbols as ``symbols(named:mangled:)``:
+    /// a symbol matches if its name is equal to `name`,
+    /// or if its name without the first character is equal to `name`.
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - index: Name index built from this mach-o.
+    /// - Returns: Matched symbols
+    public func symbols(
+        named name: String,
+        using index: SymbolNameIndex
+    ) -> [Symbol] {
+        _symbolIndices(named: name, using: index).compactMap {
+            _symbol(atIndex: $0)
+        }
+    }
+
+    /// Find the symbol matching the given name using a prebuilt index.
+    /// Search only for symbols defined within this mach-o
+    ///
+    /// Returns the same symbol as ``symbol(named:mangled:inSection:isGlobalOnly:)``:
+    /// a symbol matches if its name is equal to `name`,
+    /// or if `"_"` followed by its name is equal to `name`.
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Name index built from this mach-o.
+    /// - Returns: Matched symbol
+    public func symbol(
+        named name: String,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolNameIndex
+    ) -> Symbol? {
+        _symbol(
+            in: _symbolIndices(underscoredNamed: name, using: index),
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            symbolAt: { _symbol(atIndex: $0) }
+        )
+    }
+
+    private func _symbolIndices(
+        named name: String,
+        using index: SymbolNameIndex
+    ) -> [Int] {
+        name.withCString { nameC -> [Int] in
+            if is64Bit, let symbols64 {
+                return index.symbolIndices(named: nameC, in: symbols64)
+            } else if let symbols32 {
+                return index.symbolIndices(named: nameC, in: symbols32)
+            }
+            return []
+        }
+    }
+
+    private func _symbolIndices(
+        underscoredNamed name: String,
+        using index: SymbolNameIndex
+    ) -> [Int] {
+        name.withCString { nameC -> [Int] in
+            if is64Bit, let symbols64 {
+                return index.symbolIndices(underscoredNamed: nameC, in: symbols64)
+            } else if let symbols32 {
+                return index.symbolIndices(underscoredNamed: nameC, in: symbols32)
+            }
+            return []
+        }
+    }
+}
+
+extension MachORepresentable where Self == MachOImage {
+    /// Build a hash index of symbol names.
+    ///
+    /// Since `MachOImage` does not hold any state, keep the returned index to reuse it.
+    /// - Returns: Built index, or nil if there is no symbol table.
+    public func makeSymbolNameIndex() -> SymbolNameIndex? {
+        if is64Bit, let symbols64 {
+            return .init(symbols: symbols64)
+        } else if let symbols32 {
+            return .init(symbols: symbols32)
+        }
+        return nil
+    }
+
+    /// Find the symbols matching the given name using a prebuilt index.
+    ///
+    /// Returns the same symbols as ``symbols(named:mangled:)``:
+    /// a symbol matches if its name is equal to `name`,
+    /// or if its name without the first character is equal to `name`.
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - index: Name index built from this mach-o.
+    /// - Returns: Matched symbols
+    public func symbols(
+        named name: String,
+        using index: SymbolNameIndex
+    ) -> [Symbol] {
+        _symbolIndices(named: name, using: index).compactMap {
+            _symbol(atIndex: $0)
+        }
+    }
+
+    /// Find the symbol matching the given name using a prebuilt index.
+    /// Search only for symbols defined within this mach-o
+    ///
+    /// Returns the same symbol as ``symbol(named:mangled:inSection:isGlobalOnly:)``.
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - index: Name index built from this mach-o.
+    /// - Returns: Matched symbol
+    public func symbol(
+        named name: String,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using index: SymbolNameIndex
+    ) -> Symbol? {
+        _symbol(
+            in: _symbolIndices(named: name, using: index),
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            symbolAt: { _symbol(atIndex: $0) }
+        )
+    }
+
+    private func _symbolIndices(
+        named name: String,
+        using index: SymbolNameIndex
+    ) -> [Int] {
+        name.withCString { nameC -> [Int] in
+            if is64Bit, let symbols64 {
+                return index.symbolIndices(named: nameC, in: symbols64)
+            } else if let symbols32 {
+                return index.symbolIndices(named: nameC, in: symbols32)
+            }
+            return []
+        }
+    }
+}
+
+extension MachORepresentable where Self == MachOFile {
+    /// Demangle all symbol names concurrently and store them in the cache.
+    ///
+    /// Use ``MachOFile/demangledNameCache`` to get a cache that is shared by this file.
+    /// - Parameters:
+    ///   - cache: Cache to be filled
+    ///   - maxConcurrency: Maximum number of threads used for demangling.
+    public func demangleSymbolNames(
+        into cache: DemangledNameCache,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) {
+        if is64Bit, let symbols64 {
+            cache.fill(from: symbols64, maxConcurrency: maxConcurrency)
+        } else if let symbols32 {
+            cache.fill(from: symbols32, maxConcurrency: maxConcurrency)
+        }
+    }
+
+    /// Find the symbols matching the given name, reusing demangled names stored in the cache.
+    ///
+    /// Returns the same symbols as ``symbols(named:mangled:)``,
+    /// except that C++ names are also compared in their demangled form.
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - mangled: If false, also compare with the demangled names.
+    ///   - cache: Demangled name cache used with this mach-o.
+    /// - Returns: Matched symbols
+    public func symbols(
+        named name: String,
+        mangled: Bool = true,
+        using cache: DemangledNameCache
+    ) -> [Symbol] {
+        _symbolIndices(named: name, mangled: mangled, using: cache).compactMap {
+            _symbol(atIndex: $0)
+        }
+    }
+
+    /// Find the symbol matching the given name, reusing demangled names stored in the cache.
+    /// Search only for symbols defined within this mach-o
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - mangled: If false, also compare with the demangled names.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - cache: Demangled name cache used with this mach-o.
+    /// - Returns: Matched symbol
+    public func symbol(
+        named name: String,
+        mangled: Bool = true,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using cache: DemangledNameCache
+    ) -> Symbol? {
+        _symbol(
+            in: _symbolIndices(
+                named: name,
+                mangled: mangled,
+                underscored: true,
+                using: cache
+            ),
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            symbolAt: { _symbol(atIndex: $0) }
+        )
+    }
+
+    private func _symbolIndices(
+        named name: String,
+        mangled: Bool,
+        underscored: Bool = false,
+        using cache: DemangledNameCache
+    ) -> [Int] {
+        if is64Bit, let symbols64 {
+            return cache.symbolIndices(
+                named: name,
+                mangled: mangled,
+                in: symbols64,
+                underscored: underscored
+            )
+        } else if let symbols32 {
+            return cache.symbolIndices(
+                named: name,
+                mangled: mangled,
+                in: symbols32,
+                underscored: underscored
+            )
+        }
+        return []
+    }
+}
+
+extension MachORepresentable where Self == MachOImage {
+    /// Demangle all symbol names concurrently and store them in the cache.
+    ///
+    /// Since `MachOImage` does not hold any state, keep the cache to reuse it.
+    /// - Parameters:
+    ///   - cache: Cache to be filled
+    ///   - maxConcurrency: Maximum number of threads used for demangling.
+    public func demangleSymbolNames(
+        into cache: DemangledNameCache,
+        maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) {
+        if is64Bit, let symbols64 {
+            cache.fill(from: symbols64, maxConcurrency: maxConcurrency)
+        } else if let symbols32 {
+            cache.fill(from: symbols32, maxConcurrency: maxConcurrency)
+        }
+    }
+
+    /// Find the symbols matching the given name, reusing demangled names stored in the cache.
+    ///
+    /// Returns the same symbols as ``symbols(named:mangled:)``,
+    /// except that C++ names are also compared in their demangled form.
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - mangled: If false, also compare with the demangled names.
+    ///   - cache: Demangled name cache used with this mach-o.
+    /// - Returns: Matched symbols
+    public func symbols(
+        named name: String,
+        mangled: Bool = true,
+        using cache: DemangledNameCache
+    ) -> [Symbol] {
+        _symbolIndices(named: name, mangled: mangled, using: cache).compactMap {
+            _symbol(atIndex: $0)
+        }
+    }
+
+    /// Find the symbol matching the given name, reusing demangled names stored in the cache.
+    /// Search only for symbols defined within this mach-o
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - mangled: If false, also compare with the demangled names.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - cache: Demangled name cache used with this mach-o.
+    /// - Returns: Matched symbol
+    public func symbol(
+        named name: String,
+        mangled: Bool = true,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false,
+        using cache: DemangledNameCache
+    ) -> Symbol? {
+        _symbol(
+            in: _symbolIndices(named: name, mangled: mangled, using: cache),
+            inSection: sectionNumber,
+            isGlobalOnly: isGlobalOnly,
+            symbolAt: { _symbol(atIndex: $0) }
+        )
+    }
+
+    private func _symbolIndices(
+        named name: String,
+        mangled: Bool,
+        underscored: Bool = false,
+        using cache: DemangledNameCache
+    ) -> [Int] {
+        if is64Bit, let symbols64 {
+            return cache.symbolIndices(
+                named: name,
+                mangled: mangled,
+                in: symbols64,
+                underscored: underscored
+            )
+        } else if let symbols32 {
+            return cache.symbolIndices(
+                named: name,
+                mangled: mangled,
+                in: symbols32,
+                underscored: underscored
+            )
+        }
+        return []
+    }
+}
+
+extension MachORepresentable {
+    /// Select the symbol in the same way as ``symbol(named:mangled:inSection:isGlobalOnly:)``
+    /// from the candidates whose name already matched.
+    /// - Parameters:
+    ///   - candidates: Positions of candidate symbols in the symbol table, in ascending order.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    ///   - symbolAt: Get symbol at position in the symbol table
+    /// - Returns: Matched symbol
+    private func _symbol(
+        in candidates: [Int],
+        inSection sectionNumber: Int,
+        isGlobalOnly: Bool,
+        symbolAt: (Int) -> Symbol?
+    ) -> Symbol? {
+        func matches(
+            _ symbol: Symbol,
+            requireNonStab: Bool,
+            requireExternal: Bool
+        ) -> Bool {
+            let nlist = symbol.nlist
+            return nlist.flags?.type == .sect &&
+                (!requireNonStab || nlist.flags?.stab == nil) &&
+                (!requireExternal || nlist.flags?.contains(.ext) ?? false) &&
+                (sectionNumber == 0 || nlist.sectionNumber == sectionNumber)
+        }
+
+        var bestSymbol: Symbol?
+
+        if let dysym = loadCommands.dysymtab {
+            // find closest match in globals
+            let globalStart: Int = numericCast(dysym.iextdefsym)
+            let globalCount: Int = numericCast(dysym.nextdefsym)
+            let globalRange = globalStart ..< globalStart + globalCount
+            for i in candidates where globalRange.contains(i) {
+                guard let symbol = symbolAt(i),
+                      matches(symbol, requireNonStab: false, requireExternal: false) else {
+                    continue
+                }
+                bestSymbol = symbol
+            }
+            if isGlobalOnly { return bestSymbol }
+
+            // find closest match in locals
+            let localStart: Int = numericCast(dysym.ilocalsym)
+            let localCount: Int = numericCast(dysym.nlocalsym)
+            let localRange = localStart ..< localStart + localCount
+            for i in candidates where localRange.contains(i) {
+                guard let symbol = symbolAt(i),
+                      matches(symbol, requireNonStab: true, requireExternal: false) else {
+                    continue
+                }
+                bestSymbol = symbol
+            }
+        } else {
+            for i in candidates {
+                guard let symbol = symbolAt(i),
+                      matches(symbol, requireNonStab: true, requireExternal: isGlobalOnly) else {
+                    continue
+                }
+                bestSymbol = symbol
+            }
+        }
+
+        return bestSymbol
+    }
+}
+
 extension MachORepresentable where IndirectSymbols.Index == Int {
     public var classicLazyBindingSymbols: [ClassicBindingSymbol]? {
         guard let indirectSymbols else { return nil }
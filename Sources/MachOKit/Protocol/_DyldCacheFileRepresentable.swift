@@ -150,10 +150,8 @@ extension _DyldCacheFileRepresentable {
         case let .v4(slideInfo):
             let rawValue: UInt32 = fileHandle.read(offset: offset)
             guard !skipsZeroValue || rawValue != 0 else { return nil }
-            let deltaMask: UInt64 = 0x00000000C0000000
-            let valueMask: UInt64 = ~deltaMask
-            runtimeOffset = numericCast(rawValue) & valueMask
-            onDiskDylibChainedPointerBaseAddress = slideInfo.value_add
+            // small values are non-pointers and are not rebased
+            return slideInfo._resolve(rawValue: rawValue).value
 
         case .v5:
             let rawValue: UInt64 = fileHandle.read(offset: offset)
@@ -15,4 +15,8 @@ protocol _SymbolTableProtocol<Symbol> {
     func wrappedNlist(at position: Int) -> WrappedNlist
     func offset(of nlist: WrappedNlist) -> Int
     func symbol(at position: Int, nlist: WrappedNlist) -> Symbol
+    /// Pointer to the null-terminated name of the symbol in the string table
+    func nameC(of nlist: WrappedNlist) -> UnsafePointer<CChar>?
+    /// Offset of the symbol name in the string table
+    func stringOffset(of nlist: WrappedNlist) -> Int
 }
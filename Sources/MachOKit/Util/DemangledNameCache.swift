@@ -0,0 +1,213 @@
+//
+//  DemangledNameCache.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Cache of demangled symbol names keyed by string table offset.
+///
+/// Names are demangled with `swift_demangle`, falling back to `__cxa_demangle` for C++ names.
+/// Names that cannot be demangled are also cached, so each name is demangled at most once.
+///
+/// Lookups by name build a name index and a map from demangled names
+/// to positions in the symbol table on first use, and reuse them afterwards.
+///
+/// Since entries are keyed by string table offset, a cache must be used with
+/// the same Mach-O that it was filled from.
+public final class DemangledNameCache: @unchecked Sendable {
+    private let lock = NSLock()
+    private var entries: [Int: String?] = [:]
+    private var nameIndex: SymbolNameIndex?
+    private var symbolIndicesByDemangledName: [String: [Int]]?
+
+    public init() {}
+
+    /// Number of cached names
+    public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries.count
+    }
+
+    /// Remove all cached names.
+    public func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeAll()
+        nameIndex = nil
+        symbolIndicesByDemangledName = nil
+    }
+}
+
+extension DemangledNameCache {
+    /// Demangle all names in the symbol table that are not cached yet.
+    ///
+    /// Names are split into chunks and demangled concurrently.
+    /// - Parameters:
+    ///   - symbols: Symbol table to demangle
+    ///   - maxConcurrency: Maximum number of chunks processed concurrently.
+    func fill<Table: _SymbolTableProtocol>(
+        from symbols: Table,
+        maxConcurrency: Int
+    ) {
+        var pending: [(stringOffset: Int, nameC: UnsafePointer<CChar>)] = []
+        var seen: Set<Int> = []
+
+        lock.lock()
+        for i in symbols.indices {
+            let nlist = symbols.wrappedNlist(at: i)
+            let stringOffset = symbols.stringOffset(of: nlist)
+            guard entries[stringOffset] == nil,
+                  seen.insert(stringOffset).inserted,
+                  let nameC = symbols.nameC(of: nlist) else {
+                continue
+            }
+            pending.append((stringOffset, nameC))
+        }
+        lock.unlock()
+
+        guard !pending.isEmpty else { return }
+
+        let chunkCount = min(max(1, maxConcurrency) * 4, pending.count)
+        let chunkSize = (pending.count + chunkCount - 1) / chunkCount
+
+        var results = [String?](repeating: nil, count: pending.count)
+        results.withUnsafeMutableBufferPointer { results in
+            DispatchQueue.concurrentPerform(iterations: chunkCount) { chunk in
+                let start = chunk * chunkSize
+                let end = min(start + chunkSize, pending.count)
+                guard start < end else { return }
+                for i in start ..< end {
+                    results[i] = Self.demangle(pending[i].nameC)
+                }
+            }
+        }
+
+        lock.lock()
+        for (entry, demangled) in zip(pending, results) {
+            entries[entry.stringOffset] = demangled
+        }
+        lock.unlock()
+    }
+
+    /// Find the positions in the symbol table of the symbols with the specified name.
+    ///
+    /// A symbol matches if its name matches `name` as specified by `underscored`.
+    /// If `mangled` is false, a symbol whose demangled name is equal to `name` also matches.
+    /// - Parameters:
+    ///   - name: Symbol name to find
+    ///   - mangled: If false, also compare with the demangled names.
+    ///   - symbols: Symbol table of the Mach-O used with this cache
+    ///   - underscored: If true, a symbol matches if `name` is equal to its name or to `"_"` followed by its name.
+    ///     Otherwise a symbol matches if its name, or its name without the first character, is equal to `name`.
+    /// - Returns: Positions of matched symbols, in ascending order.
+    func symbolIndices<Table: _SymbolTableProtocol>(
+        named name: String,
+        mangled: Bool,
+        in symbols: Table,
+        underscored: Bool
+    ) -> [Int] {
+        let index = cachedNameIndex(of: symbols)
+        let results = name.withCString { nameC -> [Int] in
+            if underscored {
+                return index.symbolIndices(underscoredNamed: nameC, in: symbols)
+            }
+            return index.symbolIndices(named: nameC, in: symbols)
+        }
+        guard !mangled else { return results }
+
+        let demangledMatches = symbolIndices(demangledName: name, in: symbols)
+        guard !demangledMatches.isEmpty else { return results }
+        return Set(results).union(demangledMatches).sorted()
+    }
+
+    /// Name index of the symbol table, built on first use.
+    private func cachedNameIndex<Table: _SymbolTableProtocol>(
+        of symbols: Table
+    ) -> SymbolNameIndex {
+        lock.lock()
+        defer { lock.unlock() }
+        if let nameIndex { return nameIndex }
+        let index = SymbolNameIndex(symbols: symbols)
+        nameIndex = index
+        return index
+    }
+
+    /// Positions of the symbols whose demangled names are equal to `name`.
+    ///
+    /// All names are demangled and grouped by demangled name on first use.
+    private func symbolIndices<Table: _SymbolTableProtocol>(
+        demangledName name: String,
+        in symbols: Table
+    ) -> [Int] {
+        lock.lock()
+        if let symbolIndicesByDemangledName {
+            lock.unlock()
+            return symbolIndicesByDemangledName[name] ?? []
+        }
+        lock.unlock()
+
+        fill(
+            from: symbols,
+            maxConcurrency: ProcessInfo.processInfo.activeProcessorCount
+        )
+
+        lock.lock()
+        defer { lock.unlock() }
+        if let symbolIndicesByDemangledName {
+            return symbolIndicesByDemangledName[name] ?? []
+        }
+        var indices: [String: [Int]] = [:]
+        for i in symbols.indices {
+            let nlist = symbols.wrappedNlist(at: i)
+            let stringOffset = symbols.stringOffset(of: nlist)
+            let demangled: String?
+            if let cached = entries[stringOffset] {
+                demangled = cached
+            } else if let nameC = symbols.nameC(of: nlist) {
+                // Removed by `removeAll()` after `fill`
+                demangled = Self.demangle(nameC)
+                entries[stringOffset] = demangled
+            } else {
+                demangled = nil
+            }
+            guard let demangled else { continue }
+            indices[demangled, default: []].append(i)
+        }
+        symbolIndicesByDemangledName = indices
+        return indices[name] ?? []
+    }
+}
+
+extension DemangledNameCache {
+    static func demangle(_ nameC: UnsafePointer<CChar>) -> String? {
+        guard nameC.pointee != 0 else { return nil }
+
+        if let demangled = _stdlib_demangleImpl(
+            mangledName: nameC,
+            mangledNameLength: numericCast(strlen(nameC)),
+            outputBuffer: nil,
+            outputBufferSize: nil,
+            flags: 0
+        ) {
+            defer { free(demangled) }
+            return .init(cString: demangled)
+        }
+
+        if let demangled = __cxa_demangle(
+            mangledName: nameC,
+            outputBuffer: nil,
+            outputBufferSize: nil,
+            status: nil
+        ) {
+            defer { free(demangled) }
+            return .init(cString: demangled)
+        }
+
+        return nil
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  DyldCacheImageIndex.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Hash index from install name (including aliases) to image in dyld cache.
+///
+/// Names are taken from the dylibs trie when it is present, so aliases are resolved
+/// without reading image paths.
+/// Older caches without the trie fall back to the path of each image info.
+struct DyldCacheImageIndex: Sendable {
+    /// Image infos in image index order
+    let imageInfos: [DyldCacheImageInfo]
+
+    private let imageIndices: [String: Int]
+
+    init(
+        imageInfos: [DyldCacheImageInfo],
+        dylibIndices: [DylibIndex],
+        path: (DyldCacheImageInfo) -> String?
+    ) {
+        var imageIndices: [String: Int] = [:]
+        if dylibIndices.isEmpty {
+            imageIndices.reserveCapacity(imageInfos.count)
+            for (index, info) in imageInfos.enumerated() {
+                guard let path = path(info) else { continue }
+                if imageIndices[path] == nil {
+                    imageIndices[path] = index
+                }
+            }
+        } else {
+            imageIndices.reserveCapacity(dylibIndices.count)
+            for dylibIndex in dylibIndices {
+                let index = Int(dylibIndex.index)
+                guard index < imageInfos.count else { continue }
+                imageIndices[dylibIndex.name] = index
+            }
+        }
+        self.imageInfos = imageInfos
+        self.imageIndices = imageIndices
+    }
+
+    /// Number of names in the index, including aliases
+    var count: Int {
+        imageIndices.count
+    }
+
+    /// Index of the image with the specified install name or alias
+    func imageIndex(forInstallName installName: String) -> Int? {
+        imageIndices[installName]
+    }
+
+    /// Image info of the image with the specified install name or alias
+    func imageInfo(forInstallName installName: String) -> DyldCacheImageInfo? {
+        guard let index = imageIndices[installName] else { return nil }
+        return imageInfos[index]
+    }
+}
+
+extension DyldCacheImageIndex {
+    /// Lazily built index, shared by copies of the owner
+    final class Storage: @unchecked Sendable {
+        private let lock = NSLock()
+        private var _index: DyldCacheImageIndex?
+
+        init() {}
+
+        func index(
+            _ build: () -> DyldCacheImageIndex?
+        ) -> DyldCacheImageIndex? {
+            lock.lock()
+            defer { lock.unlock() }
+            if let _index { return _index }
+            let index = build()
+            _index = index
+            return index
+        }
+    }
+}
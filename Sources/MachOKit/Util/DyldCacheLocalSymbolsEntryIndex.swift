@@ -0,0 +1,120 @@
+//
+//  DyldCacheLocalSymbolsEntryIndex.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Sorted index of local symbols entries for fast lookups by dylib offset.
+///
+/// Entries are sorted by `dylibOffset` and found with a binary search,
+/// instead of scanning all entries for every Mach-O.
+/// Lookups return the same entries as scanning ``DyldCacheLocalSymbolsInfo`` entries with `first(where:)`.
+///
+/// The index must be used with the local symbols info that it was built from.
+public struct DyldCacheLocalSymbolsEntryIndex: Sendable {
+    /// Sorted 64-bit format entries. Empty for 32-bit format.
+    let entries64: [DyldCacheLocalSymbolsEntry64]
+    /// Sorted 32-bit format entries. Empty for 64-bit format.
+    let entries32: [DyldCacheLocalSymbolsEntry]
+
+    /// A boolean value that indicates whether entries are in 64-bit format.
+    public let is64BitEntryFormat: Bool
+
+    // Source of entries, used to check that `self` matches a local symbols info
+    let entriesOffset: UInt32
+    let entriesCount: UInt32
+
+    /// Number of indexed entries
+    public var count: Int {
+        is64BitEntryFormat ? entries64.count : entries32.count
+    }
+}
+
+extension DyldCacheLocalSymbolsEntryIndex {
+    init<Cache: _DyldCacheFileRepresentable>(
+        info: DyldCacheLocalSymbolsInfo,
+        in cache: Cache
+    ) {
+        self.is64BitEntryFormat = info.is64BitEntryFormat(in: cache)
+        self.entries64 = Self.sorted(info._entries64(in: cache).map(Array.init) ?? [])
+        self.entries32 = Self.sorted(info._entries32(in: cache).map(Array.init) ?? [])
+        self.entriesOffset = info.layout.entriesOffset
+        self.entriesCount = info.layout.entriesCount
+    }
+
+    /// Sort by dylib offset, keeping the original order of equal offsets
+    private static func sorted<Entry: DyldCacheLocalSymbolsEntryProtocol>(
+        _ entries: [Entry]
+    ) -> [Entry] {
+        entries
+            .enumerated()
+            .sorted {
+                ($0.element.dylibOffset, $0.offset) < ($1.element.dylibOffset, $1.offset)
+            }
+            .map(\.element)
+    }
+
+    /// A boolean value that indicates whether `self` was built from the specified info.
+    func isBuilt(from info: DyldCacheLocalSymbolsInfo) -> Bool {
+        entriesOffset == info.layout.entriesOffset &&
+        entriesCount == info.layout.entriesCount
+    }
+}
+
+extension DyldCacheLocalSymbolsEntryIndex {
+    /// Returns the 64-bit local symbols entry with the specified dylib offset.
+    /// - Parameter dylibOffset: offset of dylib start
+    /// - Returns: The matching 64-bit entry, or `nil` if no match exists.
+    public func entry64(
+        forDylibOffset dylibOffset: Int
+    ) -> DyldCacheLocalSymbolsEntry64? {
+        Self.find(dylibOffset, in: entries64)
+    }
+
+    /// Returns the 32-bit local symbols entry with the specified dylib offset.
+    /// - Parameter dylibOffset: offset of dylib start
+    /// - Returns: The matching 32-bit entry, or `nil` if no match exists.
+    public func entry32(
+        forDylibOffset dylibOffset: Int
+    ) -> DyldCacheLocalSymbolsEntry? {
+        Self.find(dylibOffset, in: entries32)
+    }
+
+    /// Returns the local symbols entry with the specified dylib offset, regardless of entry format.
+    /// - Parameter dylibOffset: offset of dylib start
+    /// - Returns: The matching entry, or `nil` if no match exists.
+    public func entry(
+        forDylibOffset dylibOffset: Int
+    ) -> (any DyldCacheLocalSymbolsEntryProtocol)? {
+        if is64BitEntryFormat {
+            return entry64(forDylibOffset: dylibOffset)
+        }
+        return entry32(forDylibOffset: dylibOffset)
+    }
+
+    private static func find<Entry: DyldCacheLocalSymbolsEntryProtocol>(
+        _ dylibOffset: Int,
+        in entries: [Entry]
+    ) -> Entry? {
+        // first entry whose dylib offset is not less than `dylibOffset`
+        var lower = entries.startIndex
+        var upper = entries.endIndex
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if entries[middle].dylibOffset < dylibOffset {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        guard lower != entries.endIndex,
+              entries[lower].dylibOffset == dylibOffset else {
+            return nil
+        }
+        return entries[lower]
+    }
+}
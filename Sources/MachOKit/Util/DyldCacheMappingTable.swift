@@ -0,0 +1,115 @@
+//
+//  DyldCacheMappingTable.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Sorted interval table of dyld cache mappings.
+///
+/// Mappings are sorted by address and by file offset, and found with a binary search.
+/// The table is immutable once built, so it can be shared between threads.
+final class DyldCacheMappingTable<Mapping>: @unchecked Sendable {
+    struct Interval: Sendable {
+        let start: UInt64
+        let end: UInt64
+        /// Index in `mappings`
+        let index: Int
+
+        @inline(__always)
+        func contains(_ value: UInt64) -> Bool {
+            start <= value && value < end
+        }
+    }
+
+    let mappings: [Mapping]
+
+    private let addressIntervals: [Interval]
+    private let fileOffsetIntervals: [Interval]
+
+    init(
+        mappings: [Mapping],
+        address: (Mapping) -> UInt64,
+        fileOffset: (Mapping) -> UInt64,
+        size: (Mapping) -> UInt64
+    ) {
+        func intervals(startOf: (Mapping) -> UInt64) -> [Interval] {
+            mappings.enumerated().map { index, mapping in
+                let start = startOf(mapping)
+                let (end, overflow) = start.addingReportingOverflow(size(mapping))
+                return .init(
+                    start: start,
+                    end: overflow ? .max : end,
+                    index: index
+                )
+            }.sorted {
+                ($0.start, $0.index) < ($1.start, $1.index)
+            }
+        }
+
+        self.mappings = mappings
+        self.addressIntervals = intervals(startOf: address)
+        self.fileOffsetIntervals = intervals(startOf: fileOffset)
+    }
+}
+
+extension DyldCacheMappingTable {
+    /// Find the mapping containing the specified address.
+    func mapping(containingAddress address: UInt64) -> Mapping? {
+        find(address, in: addressIntervals)
+    }
+
+    /// Find the mapping containing the specified file offset.
+    func mapping(containingFileOffset offset: UInt64) -> Mapping? {
+        find(offset, in: fileOffsetIntervals)
+    }
+
+    @inline(__always)
+    private func find(
+        _ value: UInt64,
+        in intervals: [Interval]
+    ) -> Mapping? {
+        // first interval whose start is greater than `value`
+        var lower = intervals.startIndex
+        var upper = intervals.endIndex
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if intervals[middle].start <= value {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+
+        guard lower != intervals.startIndex,
+              intervals[lower - 1].contains(value) else {
+            return nil
+        }
+        return mappings[intervals[lower - 1].index]
+    }
+}
+
+extension DyldCacheMappingTable where Mapping == DyldCacheMappingInfo {
+    convenience init<S: Sequence>(_ mappings: S) where S.Element == Mapping {
+        self.init(
+            mappings: Array(mappings),
+            address: \.address,
+            fileOffset: \.fileOffset,
+            size: \.size
+        )
+    }
+}
+
+extension DyldCacheMappingTable where Mapping == DyldCacheMappingAndSlideInfo {
+    convenience init<S: Sequence>(_ mappings: S) where S.Element == Mapping {
+        self.init(
+            mappings: Array(mappings),
+            address: \.address,
+            fileOffset: \.fileOffset,
+            size: \.size
+        )
+    }
+}
@@ -0,0 +1,297 @@
+//
+//  DyldCacheSlidView.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+#if compiler(>=6.0) || (compiler(>=5.10) && hasFeature(AccessLevelOnImport))
+internal import FileIO
+internal import FileIOBinary
+#else
+@_implementationOnly import FileIO
+@_implementationOnly import FileIOBinary
+#endif
+
+/// Read-only view of dyld cache memory after sliding, addressed by vmaddr.
+///
+/// Pages of ``pageSize`` bytes are materialized on first access,
+/// by copying the mapped bytes and applying slide info to them,
+/// and kept in a cache that evicts the least recently used pages.
+/// Whole mappings are never rebuilt in memory.
+/// Bytes of a page that are not covered by any mapping read as zero.
+///
+/// Values of pointers are their unslid targets plus ``slide``.
+/// Authenticated pointers are not signed.
+/// Non-pointer values in delta chains have their chain bits removed.
+/// Mappings without slide info are read as they are in the file.
+///
+/// Use ``DyldCache/slidView(slide:maxPageCount:)`` or
+/// ``FullDyldCache/slidView(slide:maxPageCount:)`` to create it.
+public final class DyldCacheSlidView: @unchecked Sendable {
+    /// Size of materialized pages
+    public static let pageSize = 0x4000
+
+    /// Slide added to the targets of rebased pointers
+    public let slide: UInt64
+    /// Maximum number of materialized pages kept at once
+    public let maxPageCount: Int
+    /// Size of pointers in the cache
+    public let pointerSize: Int
+
+    struct Mapping {
+        let address: UInt64
+        let size: UInt64
+        let fileOffset: UInt64
+        /// Page size of slide info
+        let slidePageSize: Int
+        /// Size of values in the delta chains
+        let chainValueSize: Int
+        /// Call the closure with each chain entry of the specified slide info page.
+        /// `nil` if the mapping has no slide info.
+        let forEachChainEntry: ((Int, (DyldCacheSlideChainEntry) -> Void) -> Void)?
+    }
+
+    /// Mappings sorted by address
+    private let mappings: [Mapping]
+    private let readFileData: (_ fileOffset: UInt64, _ length: Int) -> Data?
+
+    private let lock = NSLock()
+    private var pages: LRUCache<UInt64, [UInt8]>
+
+    init(
+        mappings: [Mapping],
+        pointerSize: Int,
+        slide: UInt64,
+        maxPageCount: Int,
+        readFileData: @escaping (_ fileOffset: UInt64, _ length: Int) -> Data?
+    ) {
+        self.mappings = mappings.sorted { $0.address < $1.address }
+        self.pointerSize = pointerSize
+        self.slide = slide
+        self.maxPageCount = max(1, maxPageCount)
+        self.readFileData = readFileData
+        self.pages = .init(capacity: max(1, maxPageCount))
+    }
+
+    /// Number of currently materialized pages
+    public var materializedPageCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return pages.count
+    }
+}
+
+extension DyldCacheSlidView {
+    /// Read a value of the specified type at the address.
+    /// - Parameters:
+    ///   - address: unslid vmaddr
+    ///   - type: type of value. Must be a trivial type.
+    /// - Returns: value, or `nil` if it is in a page outside the mappings
+    public func read<T>(
+        at address: UInt64,
+        as type: T.Type = T.self
+    ) -> T? {
+        let size = MemoryLayout<T>.size
+        let pageSize = UInt64(Self.pageSize)
+        let offsetInPage = Int(address % pageSize)
+
+        // Fast path for values inside a single page
+        if offsetInPage + size <= Self.pageSize {
+            guard let page = page(at: address / pageSize) else {
+                return nil
+            }
+            return page.withUnsafeBytes {
+                $0.loadUnaligned(fromByteOffset: offsetInPage, as: T.self)
+            }
+        }
+
+        guard let data = readData(at: address, length: size) else {
+            return nil
+        }
+        return data.withUnsafeBytes {
+            $0.loadUnaligned(as: T.self)
+        }
+    }
+
+    /// Read a pointer at the address.
+    /// - Parameter address: unslid vmaddr
+    /// - Returns: value of pointer, or `nil` if it is in a page outside the mappings
+    public func readPointer(at address: UInt64) -> UInt64? {
+        if pointerSize == 8 {
+            return read(at: address, as: UInt64.self)
+        }
+        return read(at: address, as: UInt32.self).map(UInt64.init)
+    }
+
+    /// Read bytes at the address.
+    /// - Parameters:
+    ///   - address: unslid vmaddr
+    ///   - length: number of bytes
+    /// - Returns: bytes, or `nil` if any page is outside the mappings
+    public func readData(at address: UInt64, length: Int) -> Data? {
+        guard length >= 0 else { return nil }
+        let (end, overflow) = address.addingReportingOverflow(UInt64(length))
+        guard !overflow else { return nil }
+
+        let pageSize = UInt64(Self.pageSize)
+        var data = Data(capacity: length)
+        var current = address
+        while current < end {
+            guard let page = page(at: current / pageSize) else {
+                return nil
+            }
+            let offsetInPage = Int(current % pageSize)
+            let count = Int(min(end - current, pageSize - UInt64(offsetInPage)))
+            data.append(contentsOf: page[offsetInPage ..< offsetInPage + count])
+            current += UInt64(count)
+        }
+        return data
+    }
+
+    /// Remove all materialized pages.
+    public func purge() {
+        lock.lock()
+        defer { lock.unlock() }
+        pages.removeAll()
+    }
+}
+
+extension DyldCacheSlidView {
+    private func page(at pageIndex: UInt64) -> [UInt8]? {
+        lock.lock()
+        if let page = pages.value(forKey: pageIndex) {
+            lock.unlock()
+            return page
+        }
+        lock.unlock()
+
+        // Materialize outside the lock, so other pages can be read meanwhile
+        guard let page = materializePage(at: pageIndex) else {
+            return nil
+        }
+
+        lock.lock()
+        defer { lock.unlock() }
+        if let page = pages.value(forKey: pageIndex) {
+            return page
+        }
+        pages.setValue(page, forKey: pageIndex)
+        return page
+    }
+
+    private func materializePage(at pageIndex: UInt64) -> [UInt8]? {
+        let pageSize = UInt64(Self.pageSize)
+        let pageStart = pageIndex * pageSize
+        let pageEnd = pageStart + pageSize
+
+        var bytes = [UInt8](repeating: 0, count: Self.pageSize)
+        var isMapped = false
+
+        for mapping in mappings {
+            let mappingEnd = mapping.address + mapping.size
+            let start = max(pageStart, mapping.address)
+            let end = min(pageEnd, mappingEnd)
+            guard start < end else { continue }
+
+            guard let data = readFileData(
+                mapping.fileOffset + (start - mapping.address),
+                Int(end - start)
+            ), data.count == Int(end - start) else {
+                continue
+            }
+            isMapped = true
+            let offset = Int(start - pageStart)
+            bytes.replaceSubrange(offset ..< offset + data.count, with: data)
+
+            guard let forEachChainEntry = mapping.forEachChainEntry else {
+                continue
+            }
+            let slidePageSize = UInt64(mapping.slidePageSize)
+            let firstSlidePage = (start - mapping.address) / slidePageSize
+            let lastSlidePage = (end - 1 - mapping.address) / slidePageSize
+            for slidePage in firstSlidePage ... lastSlidePage {
+                forEachChainEntry(Int(slidePage)) { entry in
+                    let address = mapping.address + (entry.fileOffset - mapping.fileOffset)
+                    guard start <= address,
+                          address + UInt64(mapping.chainValueSize) <= end else {
+                        return
+                    }
+                    let value = entry.isRebase ? entry.value &+ slide : entry.value
+                    let offset = Int(address - pageStart)
+                    bytes.withUnsafeMutableBytes {
+                        if mapping.chainValueSize == 8 {
+                            $0.storeBytes(of: value, toByteOffset: offset, as: UInt64.self)
+                        } else {
+                            $0.storeBytes(
+                                of: UInt32(truncatingIfNeeded: value),
+                                toByteOffset: offset,
+                                as: UInt32.self
+                            )
+                        }
+                    }
+                }
+            }
+        }
+
+        return isMapped ? bytes : nil
+    }
+}
+
+extension _DyldCacheFileRepresentable {
+    func _slidView(
+        slide: UInt64,
+        maxPageCount: Int
+    ) -> DyldCacheSlidView? {
+        // Caches without slide info in mappings cannot be slid
+        guard let mappingAndSlideInfos else { return nil }
+
+        var mappings: [DyldCacheSlidView.Mapping] = []
+        for mapping in mappingAndSlideInfos {
+            guard let decoder = DyldCacheSlidePageDecoder(mapping: mapping, in: self) else {
+                // Slide info that cannot be decoded would leave pointers unslid
+                let version = mapping.slideInfoVersion(in: self) ?? .none
+                guard version == .none else { return nil }
+                mappings.append(
+                    .init(
+                        address: mapping.address,
+                        size: mapping.size,
+                        fileOffset: mapping.fileOffset,
+                        slidePageSize: DyldCacheSlidView.pageSize,
+                        chainValueSize: 8,
+                        forEachChainEntry: nil
+                    )
+                )
+                continue
+            }
+            mappings.append(
+                .init(
+                    address: mapping.address,
+                    size: mapping.size,
+                    fileOffset: mapping.fileOffset,
+                    slidePageSize: decoder.pageSize,
+                    chainValueSize: decoder.pointerSize,
+                    forEachChainEntry: { pageIndex, body in
+                        decoder.forEachChainEntry(inPage: pageIndex, body)
+                    }
+                )
+            )
+        }
+
+        let fileHandle = self.fileHandle
+        return .init(
+            mappings: mappings,
+            pointerSize: cpu.is64Bit ? 8 : 4,
+            slide: slide,
+            maxPageCount: maxPageCount,
+            readFileData: { fileOffset, length in
+                try? fileHandle.readData(
+                    offset: numericCast(fileOffset),
+                    length: length
+                )
+            }
+        )
+    }
+}
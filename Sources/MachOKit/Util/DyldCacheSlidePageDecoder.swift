@@ -0,0 +1,342 @@
+//
+//  DyldCacheSlidePageDecoder.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+import MachOKitC
+#if compiler(>=6.0) || (compiler(>=5.10) && hasFeature(AccessLevelOnImport))
+internal import FileIO
+internal import FileIOBinary
+#else
+@_implementationOnly import FileIO
+@_implementationOnly import FileIOBinary
+#endif
+
+/// Decoder of rebases in the pages of a mapping, based on its slide info.
+///
+/// Slide info, page starts, page extras and the v1 bitmaps are read once per mapping.
+/// Each page is then decoded by walking its delta chains once,
+/// instead of resolving every pointer with a separate lookup.
+///
+/// Targets are the same values that `_resolveRebase(at:skipsZeroValue:)` returns for each rebased pointer.
+///
+/// [dyld implementation](https://github.com/apple-oss-distributions/dyld/blob/66c652a1f1f6b7b5266b8bbfd51cb0965d67cc44/common/DyldSharedCache.cpp)
+struct DyldCacheSlidePageDecoder<Cache: _DyldCacheFileRepresentable> {
+    enum Info {
+        case v1(
+            toc: [UInt16],
+            entries: [DyldCacheSlideInfo1.Entry]
+        )
+        case v2(
+            DyldCacheSlideInfo2,
+            starts: [DyldCacheSlideInfo2.PageStart],
+            extras: [DyldCacheSlideInfo2.PageExtra]
+        )
+        case v3(starts: [DyldCacheSlideInfo3.PageStart])
+        case v4(
+            DyldCacheSlideInfo4,
+            starts: [DyldCacheSlideInfo4.PageStart],
+            extras: [DyldCacheSlideInfo4.PageExtra]
+        )
+        case v5(starts: [DyldCacheSlideInfo5.PageStart])
+    }
+
+    let cache: Cache
+    let mapping: DyldCacheMappingAndSlideInfo
+    let info: Info
+    let pageSize: Int
+    let sharedRegionStart: UInt64
+
+    init?(mapping: DyldCacheMappingAndSlideInfo, in cache: Cache) {
+        guard let slideInfo = mapping.slideInfo(in: cache) else {
+            return nil
+        }
+        switch slideInfo {
+        case let .v1(slideInfo):
+            guard slideInfo.layout.entries_size == DyldCacheSlideInfo1.Entry.layoutSize else {
+                return nil
+            }
+            self.info = .v1(
+                toc: slideInfo._toc(in: cache).map(Array.init) ?? [],
+                entries: slideInfo._entries(in: cache).map(Array.init) ?? []
+            )
+            // v1 bitmaps cover 4KB pages
+            self.pageSize = 4096
+        case let .v2(slideInfo):
+            self.info = .v2(
+                slideInfo,
+                starts: slideInfo._pageStarts(in: cache).map(Array.init) ?? [],
+                extras: slideInfo._pageExtras(in: cache).map(Array.init) ?? []
+            )
+            self.pageSize = slideInfo.pageSize
+        case let .v3(slideInfo):
+            self.info = .v3(
+                starts: slideInfo._pageStarts(in: cache).map(Array.init) ?? []
+            )
+            self.pageSize = slideInfo.pageSize
+        case let .v4(slideInfo):
+            self.info = .v4(
+                slideInfo,
+                starts: slideInfo._pageStarts(in: cache).map(Array.init) ?? [],
+                extras: slideInfo._pageExtras(in: cache).map(Array.init) ?? []
+            )
+            self.pageSize = slideInfo.pageSize
+        case let .v5(slideInfo):
+            self.info = .v5(
+                starts: slideInfo._pageStarts(in: cache).map(Array.init) ?? []
+            )
+            self.pageSize = slideInfo.pageSize
+        }
+        guard pageSize > 0 else { return nil }
+
+        self.cache = cache
+        self.mapping = mapping
+        self.sharedRegionStart = cache.mainCacheHeader.sharedRegionStart
+    }
+
+    /// Number of pages described by the slide info
+    var numberOfPages: Int {
+        switch info {
+        case let .v1(toc, _): toc.count
+        case let .v2(_, starts, _): starts.count
+        case let .v3(starts): starts.count
+        case let .v4(_, starts, _): starts.count
+        case let .v5(starts): starts.count
+        }
+    }
+}
+
+/// Pointer or non-pointer value in a delta chain of slide info
+struct DyldCacheSlideChainEntry {
+    let fileOffset: UInt64
+    /// Unslid target if `isRebase`, otherwise the value with the chain bits removed
+    let value: UInt64
+    let isRebase: Bool
+}
+
+extension DyldCacheSlidePageDecoder {
+    typealias ChainEntry = DyldCacheSlideChainEntry
+
+    /// Size of values in the chains
+    var pointerSize: Int {
+        switch info {
+        case .v1, .v4: 4
+        case .v2, .v3, .v5: 8
+        }
+    }
+
+    /// Append all rebases in the specified page to `rebases`.
+    /// - Parameters:
+    ///   - pageIndex: index of page in the mapping
+    ///   - rebases: destination of rebases, in chain order
+    func decode(
+        page pageIndex: Int,
+        into rebases: inout [DyldCacheSlideRebase]
+    ) {
+        forEachChainEntry(inPage: pageIndex) { entry in
+            guard entry.isRebase else { return }
+            rebases.append(
+                .init(fileOffset: entry.fileOffset, target: entry.value)
+            )
+        }
+    }
+
+    /// Call `body` for each value in the delta chains of the specified page, in chain order.
+    /// - Parameters:
+    ///   - pageIndex: index of page in the mapping
+    ///   - body: called with each chain entry
+    func forEachChainEntry(
+        inPage pageIndex: Int,
+        _ body: (ChainEntry) -> Void
+    ) {
+        guard 0 <= pageIndex, pageIndex < numberOfPages else { return }
+        let pageOffset = UInt64(pageIndex) * UInt64(pageSize)
+        guard pageOffset < mapping.size else { return }
+
+        let page = Page(
+            fileOffset: mapping.fileOffset + pageOffset,
+            size: min(UInt64(pageSize), mapping.size - pageOffset)
+        )
+
+        switch info {
+        case let .v1(toc, entries):
+            let entryIndex = Int(toc[pageIndex])
+            guard entryIndex < entries.count else { return }
+            decodeV1(page: page, entry: entries[entryIndex], body)
+
+        case let .v2(slideInfo, starts, extras):
+            let start = starts[pageIndex]
+            guard !start.isNoRebase else { return }
+            if let extrasStartIndex = start.extrasStartIndex {
+                for extra in extras[min(extrasStartIndex, extras.count)...] {
+                    let chainStart = UInt64(extra.value & ~UInt16(DYLD_CACHE_SLIDE_PAGE_ATTRS)) * 4
+                    decodeV2(page: page, chainStart: chainStart, slideInfo: slideInfo, body)
+                    if extra.isEnd { break }
+                }
+            } else {
+                let chainStart = UInt64(start.value) * 4
+                decodeV2(page: page, chainStart: chainStart, slideInfo: slideInfo, body)
+            }
+
+        case let .v3(starts):
+            let start = starts[pageIndex]
+            guard !start.isNoRebase else { return }
+            decodeARM64EChain(page: page, chainStart: UInt64(start.value), body: body) {
+                .arm64e(.init(rawValue: $0))
+            }
+
+        case let .v4(slideInfo, starts, extras):
+            let start = starts[pageIndex]
+            guard !start.isNoRebase else { return }
+            if let extrasStartIndex = start.extrasStartIndex {
+                for extra in extras[min(extrasStartIndex, extras.count)...] {
+                    let chainStart = UInt64(extra.value & UInt16(DYLD_CACHE_SLIDE4_PAGE_INDEX)) * 4
+                    decodeV4(page: page, chainStart: chainStart, slideInfo: slideInfo, body)
+                    if extra.isEnd { break }
+                }
+            } else {
+                let chainStart = UInt64(start.value & UInt16(DYLD_CACHE_SLIDE4_PAGE_INDEX)) * 4
+                decodeV4(page: page, chainStart: chainStart, slideInfo: slideInfo, body)
+            }
+
+        case let .v5(starts):
+            let start = starts[pageIndex]
+            guard !start.isNoRebase else { return }
+            decodeARM64EChain(page: page, chainStart: UInt64(start.value), body: body) {
+                .arm64e_shared_cache(.init(rawValue: $0))
+            }
+        }
+    }
+}
+
+extension DyldCacheSlidePageDecoder {
+    struct Page {
+        let fileOffset: UInt64
+        /// Bytes of the page inside the mapping
+        let size: UInt64
+
+        @inline(__always)
+        func contains(_ offset: UInt64, length: UInt64) -> Bool {
+            offset <= size && length <= size - offset
+        }
+    }
+
+    /// Bitmap of 32-bit pointers, one bit per 4 bytes
+    private func decodeV1(
+        page: Page,
+        entry: DyldCacheSlideInfo1.Entry,
+        _ body: (ChainEntry) -> Void
+    ) {
+        withUnsafeBytes(of: entry.layout.bits) { bits in
+            for (byteIndex, byte) in bits.enumerated() where byte != 0 {
+                for bit in 0 ..< 8 where byte & (1 << bit) != 0 {
+                    let offset = UInt64(byteIndex * 8 + bit) * 4
+                    guard page.contains(offset, length: 4) else { return }
+                    let fileOffset = page.fileOffset + offset
+                    let value: UInt32 = cache.fileHandle.read(offset: fileOffset)
+                    body(.init(fileOffset: fileOffset, value: numericCast(value), isRebase: true))
+                }
+            }
+        }
+    }
+
+    /// Chain of 64-bit pointers with the delta to the next pointer in `delta_mask` bits
+    private func decodeV2(
+        page: Page,
+        chainStart: UInt64,
+        slideInfo: DyldCacheSlideInfo2,
+        _ body: (ChainEntry) -> Void
+    ) {
+        let deltaMask = slideInfo.layout.delta_mask
+        let valueMask = ~deltaMask
+        let valueAdd = slideInfo.layout.value_add
+        // deltas are in 4-byte units
+        let deltaShift = UInt64(max(deltaMask.trailingZeroBitCount - 2, 0))
+
+        var offset = chainStart
+        while page.contains(offset, length: 8) {
+            let fileOffset = page.fileOffset + offset
+            let rawValue: UInt64 = cache.fileHandle.read(offset: fileOffset)
+            let value = rawValue & valueMask
+            if value != 0 {
+                body(.init(fileOffset: fileOffset, value: value + valueAdd, isRebase: true))
+            } else {
+                body(.init(fileOffset: fileOffset, value: 0, isRebase: false))
+            }
+            let delta = (rawValue & deltaMask) >> deltaShift
+            guard delta != 0 else { break }
+            offset += delta
+        }
+    }
+
+    /// Chain of 32-bit pointers with the delta to the next pointer in `delta_mask` bits.
+    /// Small values are non-pointers and are not rebased.
+    private func decodeV4(
+        page: Page,
+        chainStart: UInt64,
+        slideInfo: DyldCacheSlideInfo4,
+        _ body: (ChainEntry) -> Void
+    ) {
+        let deltaMask = UInt32(truncatingIfNeeded: slideInfo.layout.delta_mask)
+        // deltas are in 4-byte units
+        let deltaShift = UInt32(max(deltaMask.trailingZeroBitCount - 2, 0))
+
+        var offset = chainStart
+        while page.contains(offset, length: 4) {
+            let fileOffset = page.fileOffset + offset
+            let rawValue: UInt32 = cache.fileHandle.read(offset: fileOffset)
+            let (value, isRebase) = slideInfo._resolve(rawValue: rawValue)
+            body(.init(fileOffset: fileOffset, value: value, isRebase: isRebase))
+            let delta = (rawValue & deltaMask) >> deltaShift
+            guard delta != 0 else { break }
+            offset += UInt64(delta)
+        }
+    }
+
+    /// Chain of arm64e pointers (v3, v5) with `next` in 8-byte strides
+    private func decodeARM64EChain(
+        page: Page,
+        chainStart: UInt64,
+        body: (ChainEntry) -> Void,
+        fixupInfo: (UInt64) -> DyldChainedFixupPointerInfo
+    ) {
+        var offset = chainStart
+        while page.contains(offset, length: 8) {
+            let fileOffset = page.fileOffset + offset
+            let rawValue: UInt64 = cache.fileHandle.read(offset: fileOffset)
+            let fixup = fixupInfo(rawValue)
+            let pointer: DyldChainedFixupPointer = .init(
+                offset: Int(fileOffset),
+                fixupInfo: fixup
+            )
+            if let runtimeOffset = pointer.rebaseTargetRuntimeOffset(
+                for: cache,
+                preferedLoadAddress: sharedRegionStart
+            ) {
+                body(.init(fileOffset: fileOffset, value: runtimeOffset + sharedRegionStart, isRebase: true))
+            }
+            let next = fixup.next
+            guard next != 0 else { break }
+            offset += UInt64(next) * 8
+        }
+    }
+}
+
+extension _DyldCacheFileRepresentable {
+    func _rebases(
+        in mapping: DyldCacheMappingAndSlideInfo
+    ) -> DyldCacheSlideRebases? {
+        guard let decoder = DyldCacheSlidePageDecoder(
+            mapping: mapping,
+            in: self
+        ) else { return nil }
+        return .init(
+            numberOfPages: decoder.numberOfPages,
+            decodePage: { decoder.decode(page: $0, into: &$1) }
+        )
+    }
+}
@@ -0,0 +1,368 @@
+//
+//  DyldCacheSymbolicator.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Symbolicator for unslid addresses anywhere in a dyld shared cache.
+///
+/// Segment ranges of all images are sorted into one table when it is created,
+/// so the image containing an address is found with a binary search.
+/// Symbols of each image are merged from the symbol table, the export trie and
+/// the unmapped local symbols, and indexed on the first lookup that hits the image.
+///
+/// Use ``FullDyldCache/makeSymbolicator(maxConcurrency:)`` to create it.
+public final class DyldCacheSymbolicator: @unchecked Sendable {
+    public struct Result: Sendable {
+        /// Symbolicated vmaddr
+        public let address: UInt64
+        /// Path of the image containing the address
+        public let imagePath: String
+        /// vmaddr of the mach header of the image
+        public let imageAddress: UInt64
+        /// Name of the closest symbol not after the address
+        public let symbolName: String?
+        /// vmaddr of the symbol
+        public let symbolAddress: UInt64?
+
+        /// Offset of the address from the mach header of the image
+        public var imageOffset: UInt64 {
+            address - imageAddress
+        }
+
+        /// Offset of the address from the symbol
+        public var symbolOffset: UInt64? {
+            symbolAddress.map { address - $0 }
+        }
+    }
+
+    struct Image {
+        let machO: MachOFile
+        /// vmaddr of mach header
+        let address: UInt64
+    }
+
+    struct ImageRange {
+        let start: UInt64
+        let end: UInt64
+        let imageIndex: Int
+    }
+
+    let images: [Image]
+    /// Segment ranges of all images, sorted by start address
+    let ranges: [ImageRange]
+
+    private let localSymbols: LocalSymbols?
+    private let sharedRegionStart: UInt64
+
+    private let lock = NSLock()
+    private var symbolIndices: [Int: ImageSymbolIndex] = [:]
+
+    init(
+        images: [Image],
+        ranges: [ImageRange],
+        localSymbols: LocalSymbols?,
+        sharedRegionStart: UInt64
+    ) {
+        self.images = images
+        self.ranges = ranges.sorted {
+            ($0.start, $0.imageIndex) < ($1.start, $1.imageIndex)
+        }
+        self.localSymbols = localSymbols
+        self.sharedRegionStart = sharedRegionStart
+    }
+
+    /// Number of images
+    public var imageCount: Int {
+        images.count
+    }
+}
+
+extension DyldCacheSymbolicator {
+    /// Symbolicate the specified address.
+    /// - Parameter address: unslid vmaddr
+    /// - Returns: Image and symbol containing the address, or nil if no image contains it.
+    public func symbolicate(_ address: UInt64) -> Result? {
+        guard let position = rangePosition(containing: address) else {
+            return nil
+        }
+        let imageIndex = ranges[position].imageIndex
+        return result(
+            for: address,
+            imageIndex: imageIndex,
+            symbols: symbolIndex(forImageAt: imageIndex)
+        )
+    }
+
+    /// Symbolicate the specified addresses.
+    ///
+    /// Addresses are processed in sorted order,
+    /// so image ranges are swept once and each image index is fetched once per run of addresses.
+    /// - Parameter addresses: unslid vmaddrs
+    /// - Returns: Results in the same order as `addresses`
+    public func symbolicate(_ addresses: [UInt64]) -> [Result?] {
+        var results = [Result?](repeating: nil, count: addresses.count)
+        let order = addresses.indices.sorted {
+            addresses[$0] < addresses[$1]
+        }
+
+        var position = 0
+        var current: (imageIndex: Int, symbols: ImageSymbolIndex)?
+        for i in order {
+            let address = addresses[i]
+            while position < ranges.count, ranges[position].end <= address {
+                position += 1
+            }
+            guard position < ranges.count,
+                  ranges[position].start <= address else {
+                continue
+            }
+            let imageIndex = ranges[position].imageIndex
+            if current?.imageIndex != imageIndex {
+                current = (imageIndex, symbolIndex(forImageAt: imageIndex))
+            }
+            results[i] = result(
+                for: address,
+                imageIndex: imageIndex,
+                symbols: current?.symbols
+            )
+        }
+        return results
+    }
+
+    private func result(
+        for address: UInt64,
+        imageIndex: Int,
+        symbols: ImageSymbolIndex?
+    ) -> Result {
+        let image = images[imageIndex]
+        let symbol = symbols?.closestEntry(at: address)
+        return .init(
+            address: address,
+            imagePath: image.machO.imagePath,
+            imageAddress: image.address,
+            symbolName: symbol.flatMap { symbols?.name(of: $0, localSymbols: localSymbols) },
+            symbolAddress: symbol?.address
+        )
+    }
+
+    /// Position in `ranges` of the range containing the address
+    private func rangePosition(containing address: UInt64) -> Int? {
+        // first range whose start is greater than `address`
+        var lower = ranges.startIndex
+        var upper = ranges.endIndex
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if ranges[middle].start <= address {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        guard lower != ranges.startIndex,
+              address < ranges[lower - 1].end else {
+            return nil
+        }
+        return lower - 1
+    }
+
+    private func symbolIndex(forImageAt imageIndex: Int) -> ImageSymbolIndex {
+        lock.lock()
+        if let index = symbolIndices[imageIndex] {
+            lock.unlock()
+            return index
+        }
+        lock.unlock()
+
+        // Build outside the lock, so other images can be looked up meanwhile
+        let index = ImageSymbolIndex(
+            image: images[imageIndex],
+            localSymbols: localSymbols,
+            sharedRegionStart: sharedRegionStart
+        )
+
+        lock.lock()
+        defer { lock.unlock() }
+        if let index = symbolIndices[imageIndex] {
+            return index
+        }
+        symbolIndices[imageIndex] = index
+        return index
+    }
+}
+
+// MARK: - Symbol Tables
+
+extension DyldCacheSymbolicator {
+    enum SymbolTable {
+        case symbols64(MachOFile.Symbols64)
+        case symbols32(MachOFile.Symbols)
+
+        func name(at position: Int) -> String {
+            switch self {
+            case let .symbols64(symbols): symbols[position].name
+            case let .symbols32(symbols): symbols[position].name
+            }
+        }
+
+        /// Call `body` with position and vmaddr of each defined, non-stab symbol in the range.
+        func forEachDefinedSymbol(
+            in range: Range<Int>? = nil,
+            _ body: (_ position: Int, _ address: UInt64) -> Void
+        ) {
+            switch self {
+            case let .symbols64(symbols):
+                Self._forEachDefinedSymbol(in: symbols, range: range, body)
+            case let .symbols32(symbols):
+                Self._forEachDefinedSymbol(in: symbols, range: range, body)
+            }
+        }
+
+        private static func _forEachDefinedSymbol<Table: _SymbolTableProtocol>(
+            in symbols: Table,
+            range: Range<Int>?,
+            _ body: (_ position: Int, _ address: UInt64) -> Void
+        ) {
+            let range = range?.clamped(to: symbols.indices) ?? symbols.indices
+            for position in range {
+                let nlist = symbols.wrappedNlist(at: position)
+                guard let flags = nlist.flags,
+                      flags.type == .sect,
+                      flags.stab == nil else {
+                    continue
+                }
+                body(position, numericCast(symbols.offset(of: nlist)))
+            }
+        }
+    }
+
+    /// Unmapped local symbols in the `.symbols` cache
+    struct LocalSymbols {
+        let symbols: SymbolTable
+        let index: DyldCacheLocalSymbolsEntryIndex
+    }
+}
+
+// MARK: - Image Symbol Index
+
+extension DyldCacheSymbolicator {
+    struct ImageSymbolIndex {
+        enum Source: UInt8 {
+            case symbolTable
+            case exportTrie
+            case localSymbols
+        }
+
+        struct Entry {
+            let address: UInt64
+            let source: Source
+            let position: Int32
+        }
+
+        /// Entries sorted by address.
+        /// On equal addresses, symbol table entries come first, then exports, then local symbols.
+        let entries: [Entry]
+        let symbols: SymbolTable?
+        let exportedNames: [String]
+
+        init(
+            image: Image,
+            localSymbols: LocalSymbols?,
+            sharedRegionStart: UInt64
+        ) {
+            let machO = image.machO
+            var entries: [Entry] = []
+
+            let symbols: SymbolTable?
+            if let symbols64 = machO.symbols64 {
+                symbols = .symbols64(symbols64)
+            } else if let symbols32 = machO.symbols32 {
+                symbols = .symbols32(symbols32)
+            } else {
+                symbols = nil
+            }
+            symbols?.forEachDefinedSymbol { position, address in
+                entries.append(
+                    .init(address: address, source: .symbolTable, position: numericCast(position))
+                )
+            }
+
+            var exportedNames: [String] = []
+            machO.exportTrie?.forEachExportedSymbol { symbol, _ in
+                guard let offset = symbol.offset,
+                      symbol.flags.kind != .absolute else {
+                    return
+                }
+                entries.append(
+                    .init(
+                        address: image.address &+ UInt64(bitPattern: Int64(offset)),
+                        source: .exportTrie,
+                        position: numericCast(exportedNames.count)
+                    )
+                )
+                exportedNames.append(symbol.name)
+            }
+
+            if let localSymbols, image.address >= sharedRegionStart {
+                let dylibOffset: Int = localSymbols.index.is64BitEntryFormat
+                    ? numericCast(image.address - sharedRegionStart)
+                    : machO.headerStartOffsetInCache
+                if let entry = localSymbols.index.entry(forDylibOffset: dylibOffset) {
+                    localSymbols.symbols.forEachDefinedSymbol(in: entry.nlistRange) { position, address in
+                        entries.append(
+                            .init(address: address, source: .localSymbols, position: numericCast(position))
+                        )
+                    }
+                }
+            }
+
+            entries.sort {
+                ($0.address, $0.source.rawValue, $0.position) <
+                    ($1.address, $1.source.rawValue, $1.position)
+            }
+
+            self.entries = entries
+            self.symbols = symbols
+            self.exportedNames = exportedNames
+        }
+
+        /// Entry that has the largest address not greater than the specified address.
+        func closestEntry(at address: UInt64) -> Entry? {
+            // first entry whose address is greater than `address`
+            var lower = entries.startIndex
+            var upper = entries.endIndex
+            while lower != upper {
+                let middle = lower + (upper - lower) / 2
+                if entries[middle].address <= address {
+                    lower = middle + 1
+                } else {
+                    upper = middle
+                }
+            }
+            guard lower != entries.startIndex else { return nil }
+            // first entry with the same address
+            let bestAddress = entries[lower - 1].address
+            var best = lower - 1
+            while best > entries.startIndex, entries[best - 1].address == bestAddress {
+                best -= 1
+            }
+            return entries[best]
+        }
+
+        func name(of entry: Entry, localSymbols: LocalSymbols?) -> String? {
+            let position = Int(entry.position)
+            switch entry.source {
+            case .symbolTable:
+                return symbols?.name(at: position)
+            case .exportTrie:
+                return exportedNames[position]
+            case .localSymbols:
+                return localSymbols?.symbols.name(at: position)
+            }
+        }
+    }
+}
@@ -0,0 +1,116 @@
+//
+//  DyldChainedFixupChainWalker.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+import MachOKitC
+
+/// Walker of the fixup chains in a segment described by `dyld_chained_starts_in_segment`.
+///
+/// Chains never cross page boundaries, so each page is walked independently.
+/// Pages with `DYLD_CHAINED_PTR_START_MULTI` have their chain starts
+/// in the overflow entries following `page_start[page_count]`.
+///
+/// https://github.com/apple-oss-distributions/dyld/blob/d1a0f6869ece370913a3f749617e457f3b4cd7c4/common/MachOLoaded.cpp#L884
+internal struct DyldChainedFixupChainWalker {
+    let pointerFormat: DyldChainedFixupPointerFormat
+    let pageSize: Int
+    let pageCount: Int
+    /// Read the `page_start` entry at the index, including overflow entries.
+    /// `nil` if out of range.
+    let pageStart: (Int) -> UInt16?
+    /// Read the raw value of the fixup at the offset in the segment.
+    /// 32-bit values are zero-extended. `nil` if out of range.
+    let rawValue: (Int) -> UInt64?
+}
+
+extension DyldChainedFixupChainWalker {
+    init?(
+        startsInSegment: DyldChainedStartsInSegment,
+        pageStart: @escaping (Int) -> UInt16?,
+        rawValue: @escaping (Int) -> UInt64?
+    ) {
+        guard let pointerFormat = startsInSegment.pointerFormat,
+              startsInSegment.page_size > 0 else {
+            return nil
+        }
+        self.init(
+            pointerFormat: pointerFormat,
+            pageSize: numericCast(startsInSegment.page_size),
+            pageCount: numericCast(startsInSegment.page_count),
+            pageStart: pageStart,
+            rawValue: rawValue
+        )
+    }
+}
+
+extension DyldChainedFixupChainWalker {
+    /// Call the closure with each fixup in the page, in chain order.
+    /// - Parameters:
+    ///   - pageIndex: index of page in the segment
+    ///   - body: closure called with the offset in the segment, raw value and decoded info of each fixup.
+    ///     Return `false` to stop walking.
+    /// - Returns: `false` if stopped by `body`
+    @discardableResult
+    func walk(
+        page pageIndex: Int,
+        _ body: (_ offset: Int, _ rawValue: UInt64, _ info: DyldChainedFixupPointerInfo) throws -> Bool
+    ) rethrows -> Bool {
+        guard let start = pageStart(pageIndex),
+              start != UInt16(DYLD_CHAINED_PTR_START_NONE) else {
+            return true
+        }
+        let pageContentStart = pageIndex * pageSize
+
+        guard start & UInt16(DYLD_CHAINED_PTR_START_MULTI) != 0 else {
+            return try walkChain(at: pageContentStart + Int(start), body)
+        }
+
+        var overflowIndex = Int(start & ~UInt16(DYLD_CHAINED_PTR_START_MULTI))
+        while let start = pageStart(overflowIndex) {
+            let offsetInPage = start & ~UInt16(DYLD_CHAINED_PTR_START_LAST)
+            guard try walkChain(at: pageContentStart + Int(offsetInPage), body) else {
+                return false
+            }
+            if start & UInt16(DYLD_CHAINED_PTR_START_LAST) != 0 { break }
+            overflowIndex += 1
+        }
+        return true
+    }
+
+    /// Call the closure with each fixup in the segment, in page order and chain order within a page.
+    /// - Parameter body: closure called with the offset in the segment, raw value and decoded info of each fixup.
+    ///   Return `false` to stop walking.
+    /// - Returns: `false` if stopped by `body`
+    @discardableResult
+    func walk(
+        _ body: (_ offset: Int, _ rawValue: UInt64, _ info: DyldChainedFixupPointerInfo) throws -> Bool
+    ) rethrows -> Bool {
+        for pageIndex in 0 ..< pageCount {
+            guard try walk(page: pageIndex, body) else { return false }
+        }
+        return true
+    }
+
+    private func walkChain(
+        at offset: Int,
+        _ body: (_ offset: Int, _ rawValue: UInt64, _ info: DyldChainedFixupPointerInfo) throws -> Bool
+    ) rethrows -> Bool {
+        let stride = pointerFormat.stride
+        var offset = offset
+        while let rawValue = rawValue(offset),
+              let info = DyldChainedFixupPointerInfo(
+                rawValue: rawValue,
+                pointerFormat: pointerFormat
+              ) {
+            guard try body(offset, rawValue, info) else { return false }
+            if info.next == 0 { break }
+            offset += stride * info.next
+        }
+        return true
+    }
+}
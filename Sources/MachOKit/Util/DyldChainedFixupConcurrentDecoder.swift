@@ -0,0 +1,112 @@
+//
+//  DyldChainedFixupConcurrentDecoder.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Decodes fixup chains of segments on multiple threads, one page per work item.
+///
+/// Chains never cross page boundaries, so pages are decoded independently
+/// and their results are concatenated in order of offset.
+/// The result does not depend on the number of threads or on scheduling.
+enum DyldChainedFixupConcurrentDecoder {
+    /// Chain walker of a segment and offset of the segment from start of mach header
+    typealias Segment = (walker: DyldChainedFixupChainWalker, segmentOffset: Int)
+
+    /// Decode the fixups of the segments.
+    /// - Parameters:
+    ///   - segments: segments to decode
+    ///   - filter: kind of fixups to decode
+    ///   - maxConcurrency: Maximum number of pages decoded concurrently
+    /// - Returns: fixups sorted by offset
+    static func pointers(
+        of segments: [Segment],
+        filter: DyldChainedFixupPointerFilter,
+        maxConcurrency: Int
+    ) -> [DyldChainedFixupPointer] {
+        let segments = segments.sorted { $0.segmentOffset < $1.segmentOffset }
+
+        // Index of the first page of each segment among all pages
+        var firstPageIndices: [Int] = []
+        firstPageIndices.reserveCapacity(segments.count)
+        var pageCount = 0
+        for segment in segments {
+            firstPageIndices.append(pageCount)
+            pageCount += segment.walker.pageCount
+        }
+        guard pageCount > 0 else { return [] }
+
+        var pages = [[DyldChainedFixupPointer]](repeating: [], count: pageCount)
+        pages.withUnsafeMutableBufferPointer { pages in
+            WorkStealingScheduler.run(
+                count: pageCount,
+                maxConcurrency: maxConcurrency
+            ) { index in
+                let position = segmentIndex(
+                    containing: index,
+                    firstPageIndices: firstPageIndices
+                )
+                let segment = segments[position]
+                pages[index] = pointers(
+                    inPage: index - firstPageIndices[position],
+                    of: segment,
+                    filter: filter
+                )
+            }
+        }
+
+        var result: [DyldChainedFixupPointer] = []
+        result.reserveCapacity(pages.reduce(0) { $0 + $1.count })
+        for page in pages {
+            result.append(contentsOf: page)
+        }
+        return result
+    }
+
+    private static func pointers(
+        inPage pageIndex: Int,
+        of segment: Segment,
+        filter: DyldChainedFixupPointerFilter
+    ) -> [DyldChainedFixupPointer] {
+        var pointers: [DyldChainedFixupPointer] = []
+        var isSorted = true
+        segment.walker.walk(page: pageIndex) { offset, _, fixupInfo in
+            guard filter.matches(fixupInfo) else { return true }
+            let offset = segment.segmentOffset + offset
+            if let last = pointers.last, last.offset >= offset {
+                isSorted = false
+            }
+            pointers.append(
+                DyldChainedFixupPointer(offset: offset, fixupInfo: fixupInfo)
+            )
+            return true
+        }
+        // Chains of a multi-start page may be in any order
+        if !isSorted {
+            pointers.sort { $0.offset < $1.offset }
+        }
+        return pointers
+    }
+
+    /// Index of the last segment whose first page is not after the page
+    private static func segmentIndex(
+        containing pageIndex: Int,
+        firstPageIndices: [Int]
+    ) -> Int {
+        var lower = 0
+        var upper = firstPageIndices.count
+        while upper - lower > 1 {
+            let middle = lower + (upper - lower) / 2
+            if firstPageIndices[middle] <= pageIndex {
+                lower = middle
+            } else {
+                upper = middle
+            }
+        }
+        return lower
+    }
+}
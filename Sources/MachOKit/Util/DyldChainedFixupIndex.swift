@@ -0,0 +1,133 @@
+//
+//  DyldChainedFixupIndex.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Sorted index of the chained fixups in a segment.
+///
+/// The fixup chains of the segment are walked once,
+/// and the offset and raw value of each fixup are kept in offset order.
+/// Lookups by offset are then performed with a binary search
+/// instead of walking every chain in the segment.
+///
+/// The index must be used with the same Mach-O that it was built from.
+public struct DyldChainedFixupIndex: Sendable {
+    /// Index of the segment
+    public let segmentIndex: Int
+    /// Pointer format of fixups in the segment
+    public let pointerFormat: DyldChainedFixupPointerFormat
+    /// Offset of the segment from start of mach header (`segment_offset`)
+    public let segmentOffset: Int
+
+    /// Offsets of fixups from start of the segment, sorted
+    let offsets: [UInt32]
+    /// Raw values of fixups, in the order of `offsets`
+    let rawValues: [UInt64]
+
+    /// Number of indexed fixups
+    public var count: Int {
+        offsets.count
+    }
+}
+
+extension DyldChainedFixupIndex {
+    init(
+        walker: DyldChainedFixupChainWalker,
+        segmentIndex: Int,
+        segmentOffset: Int
+    ) {
+        var offsets: [UInt32] = []
+        var rawValues: [UInt64] = []
+        var isSorted = true
+
+        walker.walk { offset, rawValue, _ in
+            let offset = UInt32(truncatingIfNeeded: offset)
+            if let last = offsets.last, last >= offset {
+                isSorted = false
+            }
+            offsets.append(offset)
+            rawValues.append(rawValue)
+            return true
+        }
+
+        // Chains run forward in a page and pages are in order,
+        // so sorting is needed only for unusual multi-start pages.
+        if !isSorted {
+            let order = offsets.indices.sorted { offsets[$0] < offsets[$1] }
+            offsets = order.map { offsets[$0] }
+            rawValues = order.map { rawValues[$0] }
+        }
+
+        self.init(
+            segmentIndex: segmentIndex,
+            pointerFormat: walker.pointerFormat,
+            segmentOffset: segmentOffset,
+            offsets: offsets,
+            rawValues: rawValues
+        )
+    }
+}
+
+extension DyldChainedFixupIndex {
+    /// Fixup at the offset.
+    /// - Parameter offset: offset from start of mach header
+    /// - Returns: fixup, or `nil` if there is no fixup at the offset
+    public func pointer(for offset: UInt64) -> DyldChainedFixupPointer? {
+        guard let index = index(for: offset) else { return nil }
+        return pointer(at: index)
+    }
+
+    /// Raw value of the fixup at the offset.
+    /// - Parameter offset: offset from start of mach header
+    /// - Returns: raw value, or `nil` if there is no fixup at the offset
+    public func rawValue(for offset: UInt64) -> UInt64? {
+        guard let index = index(for: offset) else { return nil }
+        return rawValues[index]
+    }
+
+    /// Fixup at the position in the index.
+    /// - Parameter index: position in offset order
+    /// - Returns: fixup
+    public func pointer(at index: Int) -> DyldChainedFixupPointer? {
+        guard let fixupInfo = DyldChainedFixupPointerInfo(
+            rawValue: rawValues[index],
+            pointerFormat: pointerFormat
+        ) else {
+            return nil
+        }
+        return .init(
+            offset: segmentOffset + Int(offsets[index]),
+            fixupInfo: fixupInfo
+        )
+    }
+
+    /// Position in offset order of the fixup at the offset
+    private func index(for offset: UInt64) -> Int? {
+        guard offset >= UInt64(segmentOffset) else { return nil }
+        let offsetInSegment = offset - UInt64(segmentOffset)
+        guard offsetInSegment <= UInt64(UInt32.max) else { return nil }
+        let target = UInt32(offsetInSegment)
+
+        // first entry whose offset is not less than `target`
+        var lower = offsets.startIndex
+        var upper = offsets.endIndex
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if offsets[middle] < target {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        guard lower != offsets.endIndex,
+              offsets[lower] == target else {
+            return nil
+        }
+        return lower
+    }
+}
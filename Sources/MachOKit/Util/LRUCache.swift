@@ -0,0 +1,132 @@
+//
+//  LRUCache.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Cache with a fixed capacity that evicts the least recently used value.
+///
+/// Entries are linked in recency order over an array,
+/// so lookups, insertions and evictions are O(1).
+///
+/// Not thread-safe. Owners guard it with their own lock.
+struct LRUCache<Key: Hashable, Value> {
+    private struct Node {
+        let key: Key
+        var value: Value
+        /// More recently used node, or -1
+        var previous: Int
+        /// Less recently used node, or -1
+        var next: Int
+    }
+
+    /// Maximum number of values
+    let capacity: Int
+
+    private var nodes: [Node] = []
+    private var indices: [Key: Int] = [:]
+    /// Most recently used node, or -1
+    private var head = -1
+    /// Least recently used node, or -1
+    private var tail = -1
+
+    init(capacity: Int) {
+        precondition(capacity > 0, "capacity must be greater than 0")
+        self.capacity = capacity
+    }
+
+    /// Number of cached values
+    var count: Int {
+        nodes.count
+    }
+}
+
+extension LRUCache {
+    /// Returns the cached value and marks it as most recently used.
+    mutating func value(forKey key: Key) -> Value? {
+        guard let index = indices[key] else { return nil }
+        moveToFront(index)
+        return nodes[index].value
+    }
+
+    /// Cache the value as most recently used.
+    /// - Returns: Entry evicted to make room, if any
+    @discardableResult
+    mutating func setValue(
+        _ value: Value,
+        forKey key: Key
+    ) -> (key: Key, value: Value)? {
+        if let index = indices[key] {
+            nodes[index].value = value
+            moveToFront(index)
+            return nil
+        }
+
+        guard nodes.count >= capacity else {
+            let index = nodes.count
+            nodes.append(.init(key: key, value: value, previous: -1, next: -1))
+            indices[key] = index
+            pushFront(index)
+            return nil
+        }
+
+        // Reuse the node of the least recently used entry
+        let index = tail
+        let evicted = (key: nodes[index].key, value: nodes[index].value)
+        unlink(index)
+        indices[evicted.key] = nil
+        nodes[index] = .init(key: key, value: value, previous: -1, next: -1)
+        indices[key] = index
+        pushFront(index)
+        return evicted
+    }
+
+    /// Remove all cached values.
+    mutating func removeAll() {
+        nodes.removeAll()
+        indices.removeAll()
+        head = -1
+        tail = -1
+    }
+}
+
+extension LRUCache {
+    private mutating func moveToFront(_ index: Int) {
+        guard head != index else { return }
+        unlink(index)
+        pushFront(index)
+    }
+
+    private mutating func pushFront(_ index: Int) {
+        nodes[index].previous = -1
+        nodes[index].next = head
+        if head != -1 {
+            nodes[head].previous = index
+        }
+        head = index
+        if tail == -1 {
+            tail = index
+        }
+    }
+
+    private mutating func unlink(_ index: Int) {
+        let previous = nodes[index].previous
+        let next = nodes[index].next
+        if previous != -1 {
+            nodes[previous].next = next
+        } else {
+            head = next
+        }
+        if next != -1 {
+            nodes[next].previous = previous
+        } else {
+            tail = previous
+        }
+        nodes[index].previous = -1
+        nodes[index].next = -1
+    }
+}
@@ -0,0 +1,356 @@
+//
+//  MachOFixupApplier.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+import MachOKitC
+
+/// Applies fixups to an image mapped into memory, as dyld does at load time.
+///
+/// Chained fixups are walked in place in the mapped image, one page per work item,
+/// so that each page is read and patched while it is hot in cache.
+/// Classic rebases and binds are applied in order of location.
+///
+/// Authenticated pointers are written without signing.
+struct MachOFixupApplier {
+    /// Start of the mapped image, at the preferred load address
+    let image: UnsafeMutableRawPointer
+    /// Size of the mapped image
+    let imageSize: Int
+    /// Address at which the image is loaded
+    let baseAddress: UInt64
+    /// vmaddr of `__TEXT`
+    let preferredLoadAddress: UInt64
+    let is64Bit: Bool
+
+    var slide: UInt64 {
+        baseAddress &- preferredLoadAddress
+    }
+
+    var pointerSize: Int {
+        is64Bit ? MemoryLayout<UInt64>.size : MemoryLayout<UInt32>.size
+    }
+}
+
+// MARK: - Chained fixups
+
+extension MachOFixupApplier {
+    private struct ChainedPage {
+        let walker: DyldChainedFixupChainWalker
+        let startsInSegment: DyldChainedStartsInSegment
+        let pageIndex: Int
+    }
+
+    /// Apply chained fixups.
+    /// - Parameters:
+    ///   - chainedFixups: chained fixups of `machO`
+    ///   - machO: MachOFile mapped to `image`
+    ///   - bindTargets: resolved address of each import including its addend,
+    ///     `nil` for missing weak imports
+    ///   - maxConcurrency: Maximum number of pages patched concurrently
+    func apply(
+        _ chainedFixups: MachOFile.DyldChainedFixups,
+        in machO: MachOFile,
+        bindTargets: [UInt64?],
+        maxConcurrency: Int
+    ) throws {
+        guard let startsInImage = chainedFixups.startsInImage else { return }
+
+        var pages: [ChainedPage] = []
+        for startsInSegment in chainedFixups.startsInSegments(of: startsInImage) {
+            let pageCount: Int = numericCast(startsInSegment.page_count)
+            guard pageCount > 0 else { continue }
+            guard let pointerFormat = startsInSegment.pointerFormat else {
+                throw FixupError.unknownPointerFormat(
+                    rawValue: startsInSegment.pointer_format
+                )
+            }
+            guard pointerFormat != .arm64e_segmented else {
+                throw FixupError.unsupportedPointerFormat(pointerFormat)
+            }
+
+            let segmentOffset: Int = numericCast(startsInSegment.segment_offset)
+            let segmentSize = pageCount * numericCast(startsInSegment.page_size)
+            guard segmentOffset >= 0,
+                  segmentOffset + segmentSize <= imageSize else {
+                throw FixupError.invalidFixupLocation(offset: segmentOffset)
+            }
+
+            let segmentStart = UnsafeRawPointer(image.advanced(by: segmentOffset))
+            let is64Bit = pointerFormat.is64Bit
+            let stride = is64Bit ? MemoryLayout<UInt64>.size : MemoryLayout<UInt32>.size
+            guard let walker = chainedFixups._chainWalker(
+                of: startsInSegment,
+                rawValue: { offset in
+                    guard offset >= 0, offset + stride <= segmentSize else {
+                        return nil
+                    }
+                    if is64Bit {
+                        return segmentStart.loadUnaligned(
+                            fromByteOffset: offset,
+                            as: UInt64.self
+                        )
+                    } else {
+                        return numericCast(
+                            segmentStart.loadUnaligned(
+                                fromByteOffset: offset,
+                                as: UInt32.self
+                            )
+                        )
+                    }
+                }
+            ) else {
+                continue
+            }
+
+            for pageIndex in 0 ..< pageCount {
+                pages.append(
+                    .init(
+                        walker: walker,
+                        startsInSegment: startsInSegment,
+                        pageIndex: pageIndex
+                    )
+                )
+            }
+        }
+
+        var errors = [FixupError?](repeating: nil, count: pages.count)
+        errors.withUnsafeMutableBufferPointer { errors in
+            WorkStealingScheduler.run(
+                count: pages.count,
+                maxConcurrency: maxConcurrency
+            ) { index in
+                errors[index] = apply(
+                    pages[index],
+                    in: machO,
+                    bindTargets: bindTargets
+                )
+            }
+        }
+        // Report the error of the first page, regardless of scheduling
+        if let error = errors.lazy.compactMap({ $0 }).first {
+            throw error
+        }
+    }
+
+    /// Patch the fixups of the page in place.
+    /// - Returns: error that stopped patching, or `nil` if all fixups are applied
+    private func apply(
+        _ page: ChainedPage,
+        in machO: MachOFile,
+        bindTargets: [UInt64?]
+    ) -> FixupError? {
+        let startsInSegment = page.startsInSegment
+        let segmentOffset: Int = numericCast(startsInSegment.segment_offset)
+        let maxValidPointer: UInt32 = startsInSegment.max_valid_pointer
+        let segmentStart = image.advanced(by: segmentOffset)
+
+        var failure: FixupError?
+        page.walker.walk(page: page.pageIndex) { offset, _, fixupInfo in
+            do {
+                let value = try chainedFixupValue(
+                    of: DyldChainedFixupPointer(
+                        offset: segmentOffset + offset,
+                        fixupInfo: fixupInfo
+                    ),
+                    in: machO,
+                    maxValidPointer: maxValidPointer,
+                    bindTargets: bindTargets
+                )
+                // The walker has already decoded `next`,
+                // so the chain entry can be overwritten.
+                if fixupInfo.pointerFormat.is64Bit {
+                    segmentStart.storeBytes(
+                        of: value,
+                        toByteOffset: offset,
+                        as: UInt64.self
+                    )
+                } else {
+                    segmentStart.storeBytes(
+                        of: UInt32(truncatingIfNeeded: value),
+                        toByteOffset: offset,
+                        as: UInt32.self
+                    )
+                }
+                return true
+            } catch {
+                failure = error as? FixupError
+                return false
+            }
+        }
+        return failure
+    }
+
+    // https://github.com/apple-oss-distributions/dyld/blob/d1a0f6869ece370913a3f749617e457f3b4cd7c4/common/MachOLoaded.cpp#L1089
+    private func chainedFixupValue(
+        of pointer: DyldChainedFixupPointer,
+        in machO: MachOFile,
+        maxValidPointer: UInt32,
+        bindTargets: [UInt64?]
+    ) throws -> UInt64 {
+        let fixupInfo = pointer.fixupInfo
+
+        if fixupInfo.bind != nil {
+            guard let (ordinal, addend) = pointer.bindOrdinalAndAddend(for: machO) else {
+                throw FixupError.unsupportedPointerFormat(fixupInfo.pointerFormat)
+            }
+            guard bindTargets.indices.contains(ordinal) else {
+                throw FixupError.invalidImportOrdinal(ordinal)
+            }
+            // missing weak import
+            guard let target = bindTargets[ordinal] else { return 0 }
+            return target &+ addend
+        }
+
+        // Values of 32-bit chains above `max_valid_pointer` are not pointers
+        if fixupInfo.pointerFormat == ._32,
+           maxValidPointer != 0,
+           let rebase = fixupInfo.rebase {
+            let target = UInt32(truncatingIfNeeded: rebase.target)
+            if target > maxValidPointer {
+                let bias = (0x04000000 + maxValidPointer) / 2
+                return numericCast(target &- bias)
+            }
+        }
+
+        guard let runtimeOffset = pointer.rebaseTargetRuntimeOffset(
+            for: machO,
+            preferedLoadAddress: preferredLoadAddress
+        ) else {
+            throw FixupError.unsupportedPointerFormat(fixupInfo.pointerFormat)
+        }
+        return baseAddress &+ runtimeOffset
+    }
+}
+
+// MARK: - Classic rebase / bind opcodes
+
+extension MachOFixupApplier {
+    /// Slide the pointers at the locations of the rebases.
+    func apply(
+        _ rebases: [Rebase],
+        segments: [any SegmentCommandProtocol]
+    ) throws {
+        let locations = try rebases
+            .map { rebase -> (offset: Int, type: RebaseType) in
+                let offset = try location(
+                    segmentIndex: rebase.segmentIndex,
+                    segmentOffset: rebase.segmentOffset,
+                    segments: segments
+                )
+                return (offset, rebase.type)
+            }
+            .sorted { $0.offset < $1.offset }
+
+        for (offset, type) in locations {
+            switch type {
+            case .pointer where is64Bit:
+                let value = image.loadUnaligned(fromByteOffset: offset, as: UInt64.self)
+                image.storeBytes(of: value &+ slide, toByteOffset: offset, as: UInt64.self)
+            case .pointer, .text_absolute32:
+                let value = image.loadUnaligned(fromByteOffset: offset, as: UInt32.self)
+                image.storeBytes(
+                    of: value &+ UInt32(truncatingIfNeeded: slide),
+                    toByteOffset: offset,
+                    as: UInt32.self
+                )
+            case .text_pcrel32:
+                throw FixupError.unsupportedRebaseType(type)
+            }
+        }
+    }
+
+    /// Write the resolved addresses at the locations of the binds.
+    /// - Parameters:
+    ///   - bindings: binds to apply
+    ///   - segments: segments of the image
+    ///   - isWeakDefinition: bindings are from the weak bind table.
+    ///     Locations whose symbols are not resolved are left as they are.
+    ///   - resolve: resolver of bind targets
+    func apply(
+        _ bindings: [BindingSymbol],
+        segments: [any SegmentCommandProtocol],
+        isWeakDefinition: Bool,
+        resolve: (FixupBindTarget) -> UInt64?
+    ) throws {
+        var resolved: [FixupBindTarget: UInt64?] = [:]
+
+        let locations = try bindings
+            .map { binding -> (offset: Int, binding: BindingSymbol) in
+                let offset = try location(
+                    segmentIndex: Int(binding.segmentIndex),
+                    segmentOffset: binding.segmentOffset,
+                    segments: segments
+                )
+                return (offset, binding)
+            }
+            .sorted { $0.offset < $1.offset }
+
+        for (offset, binding) in locations {
+            let target = FixupBindTarget(
+                libraryOrdinal: isWeakDefinition
+                    ? numericCast(BIND_SPECIAL_DYLIB_WEAK_LOOKUP)
+                    : binding.libraryOrdinal,
+                symbolName: binding.symbolName,
+                isWeakImport: binding.isWeakImport
+            )
+            let address: UInt64?
+            if let cached = resolved[target] {
+                address = cached
+            } else {
+                address = resolve(target)
+                resolved[target] = .some(address)
+            }
+
+            let value: UInt64
+            if let address {
+                value = address &+ UInt64(bitPattern: Int64(binding.addend))
+            } else if isWeakDefinition {
+                continue
+            } else if binding.isWeakImport {
+                value = 0
+            } else {
+                throw FixupError.unresolvedSymbol(target)
+            }
+
+            switch binding.type {
+            case .pointer where is64Bit:
+                image.storeBytes(of: value, toByteOffset: offset, as: UInt64.self)
+            case .pointer, .text_absolute32:
+                image.storeBytes(
+                    of: UInt32(truncatingIfNeeded: value),
+                    toByteOffset: offset,
+                    as: UInt32.self
+                )
+            case .text_pcrel32:
+                let next = baseAddress &+ UInt64(offset) &+ 4
+                image.storeBytes(
+                    of: UInt32(truncatingIfNeeded: value &- next),
+                    toByteOffset: offset,
+                    as: UInt32.self
+                )
+            }
+        }
+    }
+
+    /// Offset in the image of the location in the segment
+    private func location(
+        segmentIndex: Int,
+        segmentOffset: UInt,
+        segments: [any SegmentCommandProtocol]
+    ) throws -> Int {
+        guard segments.indices.contains(segmentIndex) else {
+            throw FixupError.invalidFixupLocation(offset: numericCast(segmentOffset))
+        }
+        let address = UInt64(segments[segmentIndex].virtualMemoryAddress) &+ UInt64(segmentOffset)
+        let offset = Int(bitPattern: UInt(truncatingIfNeeded: address &- preferredLoadAddress))
+        guard offset >= 0, offset + pointerSize <= imageSize else {
+            throw FixupError.invalidFixupLocation(offset: offset)
+        }
+        return offset
+    }
+}
@@ -0,0 +1,249 @@
+//
+//  ObjCHashTableReader.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+#if compiler(>=6.0) || (compiler(>=5.10) && hasFeature(AccessLevelOnImport))
+internal import FileIO
+internal import FileIOBinary
+#else
+@_implementationOnly import FileIO
+@_implementationOnly import FileIOBinary
+#endif
+
+/// Storage of a perfect hash table, addressed by offsets from the start of the table
+internal protocol _ObjCHashTableSource {
+    /// Read a value at the offset from the start of the table
+    func read<T>(at offset: Int, as type: T.Type) -> T
+    /// Read a null-terminated string at the offset from the start of the table
+    func string(at offset: Int) -> String?
+}
+
+internal struct _ObjCHashTableMemorySource: _ObjCHashTableSource {
+    /// Start of the table
+    let basePointer: UnsafeRawPointer
+
+    func read<T>(at offset: Int, as type: T.Type) -> T {
+        basePointer.loadUnaligned(fromByteOffset: offset, as: T.self)
+    }
+
+    func string(at offset: Int) -> String? {
+        String(
+            cString: basePointer
+                .advanced(by: offset)
+                .assumingMemoryBound(to: CChar.self)
+        )
+    }
+}
+
+internal struct _ObjCHashTableFileSource<Cache: _DyldCacheFileRepresentable>: _ObjCHashTableSource {
+    let cache: Cache
+    /// Unslid vmaddr of the table
+    let address: UInt64
+    /// File offset of the table
+    let fileOffset: UInt64
+
+    func read<T>(at offset: Int, as type: T.Type) -> T {
+        cache.fileHandle.read(
+            offset: numericCast(Int(fileOffset) + offset)
+        )
+    }
+
+    func string(at offset: Int) -> String? {
+        // Strings may be in other mappings than the table
+        guard let fileOffset = cache.fileOffset(
+            of: numericCast(Int(address) + offset)
+        ) else {
+            return nil
+        }
+        return cache.fileHandle.readString(offset: fileOffset)
+    }
+}
+
+/// Reader of `objc::StringHashTable` and `objc::ObjectHashTable` built by dyld.
+///
+/// Layout after the header:
+/// ```
+/// uint32_t scramble[256];
+/// uint8_t  tab[roundedTabSize];
+/// uint8_t  checkbytes[capacity];
+/// int32_t  offsets[capacity];          // to strings, from start of table
+/// // ObjectHashTable only
+/// uint64_t objectOffsets[capacity];
+/// uint32_t duplicateCount;
+/// uint64_t duplicateOffsets[duplicateCount];
+/// ```
+/// https://github.com/apple-oss-distributions/dyld/blob/65bbeed63cec73f313b1d636e63f243964725a9d/common/ObjCStringTable.h
+internal struct _ObjCHashTableReader<Source: _ObjCHashTableSource> {
+    let layout: objc_string_hash_table
+    let source: Source
+
+    var capacity: Int { numericCast(layout.capacity) }
+
+    private var scrambleOffset: Int { MemoryLayout<objc_string_hash_table>.size }
+    private var tabOffset: Int { scrambleOffset + 256 * MemoryLayout<UInt32>.size }
+    private var checkBytesOffset: Int { tabOffset + numericCast(layout.roundedTabSize) }
+    private var targetsOffset: Int { checkBytesOffset + capacity }
+    private var objectsOffset: Int { targetsOffset + capacity * MemoryLayout<Int32>.size }
+    private var duplicateCountOffset: Int { objectsOffset + capacity * MemoryLayout<UInt64>.size }
+    private var duplicatesOffset: Int { duplicateCountOffset + MemoryLayout<UInt32>.size }
+}
+
+extension _ObjCHashTableReader {
+    /// Index of the slot for the key, or `nil` if the key is not in the table
+    func index(of key: String) -> Int? {
+        let bytes = Array(key.utf8)
+        let hash = bytes.withUnsafeBytes {
+            ObjCPerfectHash.lookup8($0, level: layout.salt)
+        }
+        guard let index = index(forHash: hash) else { return nil }
+
+        // Use check byte to reject without reading the string
+        let checkByte: UInt8 = source.read(at: checkBytesOffset + index, as: UInt8.self)
+        guard checkByte == ObjCPerfectHash.checkByte(bytes) else {
+            return nil
+        }
+
+        guard let name = name(at: index), name == key else {
+            return nil
+        }
+        return index
+    }
+
+    /// Index of the slot that a key with the hash can be in.
+    ///
+    /// The key must be compared with the slot, since any hash maps to a slot.
+    func index(forHash hash: UInt64) -> Int? {
+        let tab: UInt8 = source.read(
+            at: tabOffset + Int(hash & UInt64(layout.mask)),
+            as: UInt8.self
+        )
+        let scramble: UInt32 = source.read(
+            at: scrambleOffset + Int(tab) * MemoryLayout<UInt32>.size,
+            as: UInt32.self
+        )
+        let index = Int(UInt32(truncatingIfNeeded: hash >> layout.shift) ^ scramble)
+        guard index < capacity else { return nil }
+        return index
+    }
+
+    /// Offset of the string in the slot from the start of the table,
+    /// or `nil` if the slot is empty
+    func target(at index: Int) -> Int? {
+        let target: Int32 = source.read(
+            at: targetsOffset + index * MemoryLayout<Int32>.size,
+            as: Int32.self
+        )
+        guard target != layout.sentinelTarget else { return nil }
+        return numericCast(target)
+    }
+
+    /// String in the slot, or `nil` if the slot is empty
+    func name(at index: Int) -> String? {
+        guard let target = target(at: index) else { return nil }
+        return source.string(at: target)
+    }
+}
+
+extension _ObjCHashTableReader {
+    /// Raw `ObjectData` in the slot of object hash table
+    func objectData(at index: Int) -> UInt64 {
+        readUInt64(at: objectsOffset + index * MemoryLayout<UInt64>.size)
+    }
+
+    /// Number of `ObjectData` in the duplicates list of object hash table
+    var duplicateCount: Int {
+        numericCast(source.read(at: duplicateCountOffset, as: UInt32.self))
+    }
+
+    /// Raw `ObjectData` in the duplicates list of object hash table
+    func duplicateData(at index: Int) -> UInt64 {
+        readUInt64(at: duplicatesOffset + index * MemoryLayout<UInt64>.size)
+    }
+
+    /// Read a `uint64_t` that may be only 4-byte aligned
+    func readUInt64(at offset: Int) -> UInt64 {
+        let low: UInt32 = source.read(at: offset, as: UInt32.self)
+        let high: UInt32 = source.read(at: offset + 4, as: UInt32.self)
+        return UInt64(high) << 32 | UInt64(low)
+    }
+}
+
+/// Hash functions of perfect hash tables in the objc optimization
+internal enum ObjCPerfectHash {
+    /// Bob Jenkins' 64-bit hash (lookup8)
+    /// - Parameters:
+    ///   - key: bytes of key
+    ///   - level: previous hash, or an arbitrary value (salt of table)
+    /// - Returns: hash value
+    static func lookup8(
+        _ key: UnsafeRawBufferPointer,
+        level: UInt64
+    ) -> UInt64 {
+        var a = level
+        var b = level
+        var c: UInt64 = 0x9e3779b97f4a7c13 // the golden ratio
+
+        @inline(__always)
+        func word(_ offset: Int) -> UInt64 {
+            UInt64(littleEndian: key.loadUnaligned(fromByteOffset: offset, as: UInt64.self))
+        }
+
+        // handle most of the key
+        var position = 0
+        var length = key.count
+        while length >= 24 {
+            a &+= word(position)
+            b &+= word(position + 8)
+            c &+= word(position + 16)
+            mix64(&a, &b, &c)
+            position += 24
+            length -= 24
+        }
+
+        // handle the last 23 bytes
+        c &+= UInt64(key.count)
+        for i in 0 ..< length {
+            let byte = UInt64(key[position + i])
+            switch i {
+            case 0 ..< 8: a &+= byte << (8 * i)
+            case 8 ..< 16: b &+= byte << (8 * (i - 8))
+            // the first byte of c is reserved for the length
+            default: c &+= byte << (8 * (i - 15))
+            }
+        }
+        mix64(&a, &b, &c)
+
+        return c
+    }
+
+    /// Check byte stored for each string
+    static func checkByte(_ key: [UInt8]) -> UInt8 {
+        let first = key.first ?? 0
+        return ((first & 0x7) << 5) | (UInt8(truncatingIfNeeded: key.count) & 0x1f)
+    }
+
+    @inline(__always)
+    private static func mix64(
+        _ a: inout UInt64,
+        _ b: inout UInt64,
+        _ c: inout UInt64
+    ) {
+        a &-= b; a &-= c; a ^= (c >> 43)
+        b &-= c; b &-= a; b ^= (a << 9)
+        c &-= a; c &-= b; c ^= (b >> 8)
+        a &-= b; a &-= c; a ^= (c >> 38)
+        b &-= c; b &-= a; b ^= (a << 23)
+        c &-= a; c &-= b; c ^= (b >> 5)
+        a &-= b; a &-= c; a ^= (c >> 35)
+        b &-= c; b &-= a; b ^= (a << 49)
+        c &-= a; c &-= b; c ^= (b >> 11)
+        a &-= b; a &-= c; a ^= (c >> 12)
+        b &-= c; b &-= a; b ^= (a << 18)
+        c &-= a; c &-= b; c ^= (b >> 22)
+    }
+}
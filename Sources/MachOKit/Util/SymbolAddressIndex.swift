@@ -0,0 +1,285 @@
+//
+//  SymbolAddressIndex.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Sorted index of symbol offsets for fast closest-symbol lookups.
+///
+/// Symbols are split into globals and locals, and each partition is sorted by offset
+/// (and additionally grouped by section number).
+/// Lookups are performed with a binary search instead of scanning the whole symbol table,
+/// and return the same symbols as ``MachORepresentable/closestSymbol(at:inSection:isGlobalOnly:)``.
+///
+/// The index holds only positions in the symbol table, so it must be used with
+/// the same Mach-O that it was built from.
+public struct SymbolAddressIndex: Sendable {
+    struct Entry: Sendable {
+        let offset: Int
+        let symbolIndex: UInt32
+    }
+
+    struct Partition: Sendable {
+        /// Entries in all sections, sorted by offset and symbol index
+        let entries: [Entry]
+        /// Entries sorted by section number, offset and symbol index
+        let sectionEntries: [Entry]
+        /// Range in `sectionEntries` for each section number
+        let sectionRanges: [Int: Range<Int>]
+    }
+
+    /// A boolean value that indicates whether partitions were built from `LC_DYSYMTAB`.
+    ///
+    /// If false, globals are the external symbols and locals are the others.
+    let hasDysymtab: Bool
+
+    let globals: Partition
+    let locals: Partition
+
+    /// Number of indexed symbols
+    public var count: Int {
+        globals.entries.count + locals.entries.count
+    }
+}
+
+extension SymbolAddressIndex {
+    init<MachO, Table>(
+        machO: MachO,
+        symbols: Table
+    ) where MachO: MachORepresentable, Table: _SymbolTableProtocol {
+        typealias Item = (entry: Entry, sectionNumber: Int)
+
+        var globals: [Item] = []
+        var locals: [Item] = []
+
+        func makeItem(
+            at index: Int,
+            requireNonStab: Bool
+        ) -> (Item, isExternal: Bool)? {
+            let nlist = symbols.wrappedNlist(at: index)
+            let flags = nlist.flags ?? .init(rawValue: 0)
+            guard flags.type == .sect,
+                  !requireNonStab || flags.stab == nil else {
+                return nil
+            }
+            let entry = Entry(
+                offset: symbols.offset(of: nlist),
+                symbolIndex: numericCast(index)
+            )
+            return (
+                (entry, nlist.sectionNumber ?? 0),
+                flags.contains(.ext)
+            )
+        }
+
+        if let dysym = machO.loadCommands.dysymtab {
+            let globalStart: Int = numericCast(dysym.iextdefsym)
+            let globalCount: Int = numericCast(dysym.nextdefsym)
+            let globalRange = (globalStart ..< globalStart + globalCount)
+                .clamped(to: symbols.indices)
+            for i in globalRange {
+                guard let result = makeItem(at: i, requireNonStab: false) else {
+                    continue
+                }
+                globals.append(result.0)
+            }
+
+            let localStart: Int = numericCast(dysym.ilocalsym)
+            let localCount: Int = numericCast(dysym.nlocalsym)
+            let localRange = (localStart ..< localStart + localCount)
+                .clamped(to: symbols.indices)
+            for i in localRange {
+                guard let result = makeItem(at: i, requireNonStab: true) else {
+                    continue
+                }
+                locals.append(result.0)
+            }
+            self.hasDysymtab = true
+        } else {
+            for i in symbols.indices {
+                guard let result = makeItem(at: i, requireNonStab: true) else {
+                    continue
+                }
+                if result.isExternal {
+                    globals.append(result.0)
+                } else {
+                    locals.append(result.0)
+                }
+            }
+            self.hasDysymtab = false
+        }
+
+        self.globals = .init(globals)
+        self.locals = .init(locals)
+    }
+}
+
+extension SymbolAddressIndex.Partition {
+    init(_ items: [(entry: Entry, sectionNumber: Int)]) {
+        let entries = items
+            .map(\.entry)
+            .sorted {
+                ($0.offset, $0.symbolIndex) < ($1.offset, $1.symbolIndex)
+            }
+        let sortedItems = items.sorted {
+            ($0.sectionNumber, $0.entry.offset, $0.entry.symbolIndex) <
+                ($1.sectionNumber, $1.entry.offset, $1.entry.symbolIndex)
+        }
+
+        var sectionRanges: [Int: Range<Int>] = [:]
+        var start = 0
+        for i in sortedItems.indices {
+            let sectionNumber = sortedItems[i].sectionNumber
+            if i + 1 == sortedItems.count || sortedItems[i + 1].sectionNumber != sectionNumber {
+                sectionRanges[sectionNumber] = start ..< i + 1
+                start = i + 1
+            }
+        }
+
+        self.entries = entries
+        self.sectionEntries = sortedItems.map(\.entry)
+        self.sectionRanges = sectionRanges
+    }
+
+    @inline(__always)
+    func slice(inSection sectionNumber: Int) -> ArraySlice<Entry> {
+        if sectionNumber == 0 { return entries[...] }
+        guard let range = sectionRanges[sectionNumber] else { return [] }
+        return sectionEntries[range]
+    }
+
+    /// Entries that have the largest offset not greater than the specified offset.
+    ///
+    /// Returned entries are ordered by symbol index.
+    @inline(__always)
+    func closestEntries(
+        at offset: Int,
+        inSection sectionNumber: Int
+    ) -> ArraySlice<Entry>? {
+        let candidates = slice(inSection: sectionNumber)
+
+        // first entry whose offset is greater than `offset`
+        var lower = candidates.startIndex
+        var upper = candidates.endIndex
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if candidates[middle].offset <= offset {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        guard lower != candidates.startIndex else { return nil }
+        let end = lower
+        let bestOffset = candidates[end - 1].offset
+
+        // first entry whose offset is equal to `bestOffset`
+        lower = candidates.startIndex
+        upper = end - 1
+        while lower != upper {
+            let middle = lower + (upper - lower) / 2
+            if candidates[middle].offset < bestOffset {
+                lower = middle + 1
+            } else {
+                upper = middle
+            }
+        }
+        return candidates[lower ..< end]
+    }
+}
+
+extension SymbolAddressIndex {
+    /// Find the index in the symbol table of the symbol closest to the specified offset.
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    /// - Returns: Index of closest symbol in the symbol table.
+    public func closestSymbolIndex(
+        at offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false
+    ) -> Int? {
+        let global = self.globals.closestEntries(at: offset, inSection: sectionNumber)?.first
+        if isGlobalOnly {
+            return global.map { numericCast($0.symbolIndex) }
+        }
+        let local = self.locals.closestEntries(at: offset, inSection: sectionNumber)?.first
+
+        switch (global, local) {
+        case (nil, nil):
+            return nil
+        case let (global?, nil):
+            return numericCast(global.symbolIndex)
+        case let (nil, local?):
+            return numericCast(local.symbolIndex)
+        case let (global?, local?):
+            if global.offset != local.offset {
+                return numericCast(
+                    global.offset > local.offset ? global.symbolIndex : local.symbolIndex
+                )
+            }
+            // With dysymtab, locals only win if they are strictly closer.
+            // Otherwise, the first one in the symbol table wins.
+            if hasDysymtab {
+                return numericCast(global.symbolIndex)
+            }
+            return numericCast(min(global.symbolIndex, local.symbolIndex))
+        }
+    }
+
+    /// Find the indices in the symbol table of the symbols closest to the specified offset.
+    ///
+    /// Different from ``closestSymbolIndex(at:inSection:isGlobalOnly:)`` multiple symbols with the same offset may be found.
+    ///
+    /// If sectionNumber is 0, search in all sections
+    ///
+    /// - Parameters:
+    ///   - offset: Offset from start of mach header. See ``SymbolProtocol/offset``.
+    ///   - sectionNumber: Section number to be searched.
+    ///   - isGlobalOnly: If true, search only global symbols.
+    /// - Returns: Indices of closest symbols in the symbol table.
+    public func closestSymbolIndices(
+        at offset: Int,
+        inSection sectionNumber: Int = 0,
+        isGlobalOnly: Bool = false
+    ) -> [Int] {
+        let globals = self.globals.closestEntries(at: offset, inSection: sectionNumber)
+        if isGlobalOnly {
+            return globals?.map { numericCast($0.symbolIndex) } ?? []
+        }
+        let locals = self.locals.closestEntries(at: offset, inSection: sectionNumber)
+
+        let entries: [Entry]
+        switch (globals, locals) {
+        case (nil, nil):
+            return []
+        case let (globals?, nil):
+            entries = Array(globals)
+        case let (nil, locals?):
+            entries = Array(locals)
+        case let (globals?, locals?):
+            let globalOffset = globals[globals.startIndex].offset
+            let localOffset = locals[locals.startIndex].offset
+            if globalOffset > localOffset {
+                entries = Array(globals)
+            } else if globalOffset < localOffset {
+                entries = Array(locals)
+            } else if hasDysymtab {
+                entries = Array(globals) + Array(locals)
+            } else {
+                entries = (Array(globals) + Array(locals)).sorted {
+                    $0.symbolIndex < $1.symbolIndex
+                }
+            }
+        }
+        return entries.map { numericCast($0.symbolIndex) }
+    }
+}
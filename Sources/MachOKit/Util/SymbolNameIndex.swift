@@ -0,0 +1,169 @@
+//
+//  SymbolNameIndex.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Hash index from symbol name to positions in the symbol table.
+///
+/// Raw bytes in the string table are hashed, both as is and without the first character,
+/// so names can be looked up without reading every symbol or creating a `String` for it.
+///
+/// As with ``MachORepresentable/symbols(named:mangled:)``,
+/// a symbol named `_foo` is found by both `_foo` and `foo`.
+///
+/// The index holds only positions in the symbol table, so it must be used with
+/// the same Mach-O that it was built from.
+public struct SymbolNameIndex: Sendable {
+    struct Entry: Sendable {
+        let hash: UInt32
+        let symbolIndex: UInt32
+        /// A boolean value that indicates whether the first character was skipped when hashing.
+        let isFirstCharacterSkipped: Bool
+    }
+
+    let entries: [Entry]
+    /// Open addressing table of `entries` index + 1. (0 means empty)
+    let buckets: [UInt32]
+
+    /// Number of indexed names
+    ///
+    /// Non-empty names are counted twice.
+    public var count: Int {
+        entries.count
+    }
+}
+
+extension SymbolNameIndex {
+    init<Table: _SymbolTableProtocol>(symbols: Table) {
+        var entries: [Entry] = []
+        entries.reserveCapacity(symbols.indices.count)
+
+        for i in symbols.indices {
+            let nlist = symbols.wrappedNlist(at: i)
+            guard let nameC = symbols.nameC(of: nlist) else { continue }
+            entries.append(
+                .init(
+                    hash: Self.hash(nameC),
+                    symbolIndex: numericCast(i),
+                    isFirstCharacterSkipped: false
+                )
+            )
+            if nameC.pointee != 0 {
+                entries.append(
+                    .init(
+                        hash: Self.hash(nameC + 1),
+                        symbolIndex: numericCast(i),
+                        isFirstCharacterSkipped: true
+                    )
+                )
+            }
+        }
+
+        var capacity = 16
+        while capacity < entries.count * 2 { capacity <<= 1 }
+        let mask = capacity - 1
+
+        var buckets = [UInt32](repeating: 0, count: capacity)
+        for (index, entry) in entries.enumerated() {
+            var bucket = Int(entry.hash) & mask
+            while buckets[bucket] != 0 {
+                bucket = (bucket + 1) & mask
+            }
+            buckets[bucket] = numericCast(index + 1)
+        }
+
+        self.entries = entries
+        self.buckets = buckets
+    }
+}
+
+extension SymbolNameIndex {
+    /// Find the positions in the symbol table of the symbols with the specified name.
+    /// - Parameters:
+    ///   - nameC: null-terminated symbol name to find
+    ///   - symbols: symbol table which this index was built from
+    ///   - matchesWithoutFirstCharacter: If true, a symbol whose name without the first character
+    ///     is equal to `nameC` also matches.
+    /// - Returns: Positions of matched symbols, in ascending order.
+    func symbolIndices<Table: _SymbolTableProtocol>(
+        named nameC: UnsafePointer<CChar>,
+        in symbols: Table,
+        matchesWithoutFirstCharacter: Bool = true
+    ) -> [Int] {
+        guard !buckets.isEmpty else { return [] }
+
+        let hash = Self.hash(nameC)
+        let mask = buckets.count - 1
+
+        var results: [Int] = []
+        var bucket = Int(hash) & mask
+        while buckets[bucket] != 0 {
+            let entry = entries[Int(buckets[bucket]) - 1]
+            bucket = (bucket + 1) & mask
+
+            guard entry.hash == hash,
+                  matchesWithoutFirstCharacter || !entry.isFirstCharacterSkipped else {
+                continue
+            }
+            let symbolIndex: Int = numericCast(entry.symbolIndex)
+            let nlist = symbols.wrappedNlist(at: symbolIndex)
+            guard let symbolNameC = symbols.nameC(of: nlist) else {
+                continue
+            }
+            let target = entry.isFirstCharacterSkipped ? symbolNameC + 1 : symbolNameC
+            if strcmp(nameC, target) == 0 {
+                results.append(symbolIndex)
+            }
+        }
+
+        return results.count > 1 ? results.sorted() : results
+    }
+
+    /// Find the positions in the symbol table of the symbols matched by ``MachOFile/symbol(named:mangled:inSection:isGlobalOnly:)``.
+    ///
+    /// A symbol matches if `nameC` is equal to its name, or to `"_"` followed by its name.
+    /// - Parameters:
+    ///   - nameC: null-terminated symbol name to find
+    ///   - symbols: symbol table which this index was built from
+    /// - Returns: Positions of matched symbols, in ascending order.
+    func symbolIndices<Table: _SymbolTableProtocol>(
+        underscoredNamed nameC: UnsafePointer<CChar>,
+        in symbols: Table
+    ) -> [Int] {
+        var results = symbolIndices(
+            named: nameC,
+            in: symbols,
+            matchesWithoutFirstCharacter: false
+        )
+        if nameC.pointee == CChar(UInt8(ascii: "_")) {
+            results += symbolIndices(
+                named: nameC + 1,
+                in: symbols,
+                matchesWithoutFirstCharacter: false
+            )
+            results.sort()
+        }
+        return results
+    }
+}
+
+extension SymbolNameIndex {
+    /// FNV-1a
+    @inline(__always)
+    static func hash(_ nameC: UnsafePointer<CChar>) -> UInt32 {
+        var hash: UInt32 = 0x811C9DC5
+        var ptr = UnsafeRawPointer(nameC)
+            .assumingMemoryBound(to: UInt8.self)
+        while ptr.pointee != 0 {
+            hash ^= UInt32(ptr.pointee)
+            hash &*= 0x01000193
+            ptr += 1
+        }
+        return hash
+    }
+}
@@ -35,6 +35,20 @@ extension DataTrieTree {
     }
 }
 
+extension DataTrieTree {
+    public func withUnsafeTrieBytes<R>(
+        _ body: (UnsafePointer<UInt8>, Int) throws -> R
+    ) rethrows -> R? {
+        try data.withUnsafeBytes {
+            guard let basePointer = $0.baseAddress else { return nil }
+            return try body(
+                basePointer.assumingMemoryBound(to: UInt8.self),
+                data.count
+            )
+        }
+    }
+}
+
 extension DataTrieTree: Sequence {
     public typealias Element = TrieNode<Content>
 
@@ -30,6 +30,17 @@ extension MemoryTrieTree {
     }
 }
 
+extension MemoryTrieTree {
+    public func withUnsafeTrieBytes<R>(
+        _ body: (UnsafePointer<UInt8>, Int) throws -> R
+    ) rethrows -> R? {
+        try body(
+            basePointer.assumingMemoryBound(to: UInt8.self),
+            size
+        )
+    }
+}
+
 extension MemoryTrieTree: Sequence {
     public typealias Element = TrieNode<Content>
 
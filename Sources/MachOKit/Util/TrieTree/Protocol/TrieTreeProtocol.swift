@@ -21,6 +21,22 @@ public protocol TrieTreeProtocol<Content>: Sequence where Element == TrieNode<Co
     associatedtype Content: TrieNodeContent
 
     func element(atOffset offset: Int) -> Element?
+
+    /// Calls the given closure with a pointer to the raw bytes of the trie tree and its size.
+    ///
+    /// Used to walk the trie tree without decoding each node.
+    /// - Returns: Value returned by the closure, or nil if the raw bytes are not available.
+    func withUnsafeTrieBytes<R>(
+        _ body: (UnsafePointer<UInt8>, Int) throws -> R
+    ) rethrows -> R?
+}
+
+extension TrieTreeProtocol {
+    public func withUnsafeTrieBytes<R>(
+        _ body: (UnsafePointer<UInt8>, Int) throws -> R
+    ) rethrows -> R? {
+        nil
+    }
 }
 
 extension TrieTreeProtocol {
@@ -106,6 +122,76 @@ extension TrieTreeProtocol {
     }
 }
 
+extension TrieTreeProtocol {
+    /// Visits the names and contents of all the terminals one at a time.
+    ///
+    /// Terminals are visited in the same order as ``_recurseTrie(currentName:entry:result:)``.
+    /// The trie tree is walked with an explicit stack and no intermediate array is created,
+    /// so memory usage is proportional to the depth of the trie.
+    /// If the raw bytes of the trie tree are not available,
+    /// nodes are decoded one at a time and the stack also holds the children of the nodes on the path.
+    ///
+    /// - Parameter body: Closure called with the name, node offset and content of each terminal.
+    ///                   Set `stop` to true to end the traversal.
+    public func forEachTerminal(
+        _ body: (
+            _ name: String,
+            _ offset: Int,
+            _ content: Content,
+            _ stop: inout Bool
+        ) throws -> Void
+    ) rethrows {
+        let walked: Void? = try withUnsafeTrieBytes { basePointer, trieSize in
+            let walker = _TrieTreeWalker(
+                basePointer: basePointer,
+                size: trieSize
+            )
+            try walker.forEachTerminal { name, offset, stop in
+                guard let content = walker.content(
+                    Content.self,
+                    atNodeOffset: offset
+                ) else { return }
+                try body(
+                    String(decoding: name, as: UTF8.self),
+                    offset,
+                    content,
+                    &stop
+                )
+            }
+        }
+        if walked != nil { return }
+
+        guard let root = first(where: { _ in true }) else {
+            return
+        }
+        // Each frame holds a node on the path from the root and its remaining children
+        var stack: [(name: String, children: IndexingIterator<[Element.Child]>)] = []
+        var stop = false
+        var next: (name: String, entry: Element)? = ("", root)
+
+        while true {
+            if let (name, entry) = next {
+                next = nil
+                if entry.isTerminal, let content = entry.content {
+                    try body(name, entry.offset, content, &stop)
+                    if stop { return }
+                }
+                stack.append((name, entry.children.makeIterator()))
+            }
+
+            guard !stack.isEmpty else { return }
+            guard let child = stack[stack.count - 1].children.next() else {
+                stack.removeLast()
+                continue
+            }
+            guard let entry = element(atOffset: Int(child.offset)) else {
+                continue
+            }
+            next = (stack[stack.count - 1].name + child.label, entry)
+        }
+    }
+}
+
 extension TrieTreeProtocol {
     /// Search the trie tree by name to get terminal content and node offset
     /// - Parameter key: name
@@ -113,6 +199,10 @@ extension TrieTreeProtocol {
     public func _search(by key: String) -> (offset: Int, content: Content)? {
         guard !key.isEmpty else { return nil }
 
+        if let found = _rawSearch(by: key) {
+            return found
+        }
+
         var currentLabel = ""
         var current = element(atOffset: 0)
 
@@ -136,6 +226,71 @@ extension TrieTreeProtocol {
     }
 }
 
+extension TrieTreeProtocol {
+    /// Search the trie tree by walking its raw bytes.
+    ///
+    /// Edge labels are compared directly with the UTF-8 bytes of the key,
+    /// and only the content of the found terminal is decoded.
+    /// - Parameter key: name
+    /// - Returns: `nil` if the raw bytes are not available,
+    ///            otherwise the result of the search.
+    private func _rawSearch(
+        by key: String
+    ) -> (offset: Int, content: Content)?? {
+        var key = key
+        return withUnsafeTrieBytes { basePointer, trieSize in
+            key.withUTF8 { key -> (offset: Int, content: Content)? in
+                let walker = _TrieTreeWalker(
+                    basePointer: basePointer,
+                    size: trieSize
+                )
+                guard let offset = walker.terminalOffset(for: key),
+                      let content = walker.content(
+                        Content.self,
+                        atNodeOffset: offset
+                      ) else {
+                    return nil
+                }
+                return (offset, content)
+            }
+        }
+    }
+}
+
+extension TrieTreeProtocol {
+    /// Search the trie tree by multiple names at once to get terminal contents and node offsets
+    ///
+    /// The trie tree is walked once for all keys, and keys sharing a prefix share the traversal.
+    /// Passing keys sorted in ascending order avoids sorting them internally.
+    /// - Parameter keys: names
+    /// - Returns: Terminal content and node offset for each key, in the same order as `keys`.
+    public func _search(
+        byKeys keys: [String]
+    ) -> [(offset: Int, content: Content)?] {
+        let found = withUnsafeTrieBytes { basePointer, trieSize -> [(offset: Int, content: Content)?] in
+            let walker = _TrieTreeWalker(
+                basePointer: basePointer,
+                size: trieSize
+            )
+            return walker
+                .terminalOffsets(for: keys.map { Array($0.utf8) })
+                .map { offset -> (offset: Int, content: Content)? in
+                    guard let offset,
+                          let content = walker.content(
+                            Content.self,
+                            atNodeOffset: offset
+                          ) else {
+                        return nil
+                    }
+                    return (offset, content)
+                }
+        }
+        if let found { return found }
+
+        return keys.map { _search(by: $0) }
+    }
+}
+
 extension TrieTreeProtocol {
     public func _search(
         byKeyPrefix prefix: String
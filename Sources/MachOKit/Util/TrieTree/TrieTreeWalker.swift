@@ -0,0 +1,345 @@
+//
+//  TrieTreeWalker.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Reads nodes of a trie tree directly from its raw bytes.
+///
+/// Unlike ``TrieNode/readNext(basePointer:trieSize:nextOffset:)``,
+/// children are visited in place and no `String` is created for edge labels.
+struct _TrieTreeWalker {
+    let basePointer: UnsafePointer<UInt8>
+    let size: Int
+}
+
+extension _TrieTreeWalker {
+    /// Read the size of the terminal information at the start of the node.
+    /// - Parameter offset: Offset of the node
+    /// - Returns: Terminal size and the number of bytes it occupies, or nil if out of range.
+    @inline(__always)
+    func terminalSize(ofNodeAt offset: Int) -> (value: UInt, size: Int)? {
+        guard 0 <= offset, offset < size else { return nil }
+        let (value, ulebSize) = basePointer
+            .advanced(by: offset)
+            .readULEB128()
+        return (value, ulebSize)
+    }
+
+    /// Offset of the children list of the node, or nil if out of range.
+    /// - Parameter offset: Offset of the node
+    @inline(__always)
+    func childrenOffset(ofNodeAt offset: Int) -> Int? {
+        guard let terminalSize = self.terminalSize(ofNodeAt: offset) else {
+            return nil
+        }
+        let childrenOffset = offset + terminalSize.size + Int(terminalSize.value)
+        guard childrenOffset < size else { return nil }
+        return childrenOffset
+    }
+
+    /// Decode the terminal content of the node.
+    /// - Parameters:
+    ///   - type: Type of the content
+    ///   - offset: Offset of the node
+    /// - Returns: Content, or nil if the node is not a terminal.
+    func content<Content: TrieNodeContent>(
+        _ type: Content.Type,
+        atNodeOffset offset: Int
+    ) -> Content? {
+        guard let terminalSize = self.terminalSize(ofNodeAt: offset),
+              terminalSize.value != 0 else {
+            return nil
+        }
+        var nextOffset = offset + terminalSize.size
+        return .read(
+            basePointer: basePointer,
+            trieSize: size,
+            nextOffset: &nextOffset
+        )
+    }
+
+    /// Find the node whose full label is equal to the key.
+    ///
+    /// - Parameter key: UTF-8 bytes of the name to find
+    /// - Returns: Offset of the found terminal node
+    func terminalOffset(
+        for key: UnsafeBufferPointer<UInt8>
+    ) -> Int? {
+        guard !key.isEmpty else { return nil }
+
+        var nodeOffset = 0
+        var keyIndex = 0
+
+        while keyIndex < key.count {
+            guard var offset = childrenOffset(ofNodeAt: nodeOffset) else {
+                return nil
+            }
+
+            let numberOfChildren = basePointer[offset]
+            offset += 1
+
+            var next: Int?
+            for _ in 0 ..< numberOfChildren where offset < size {
+                // compare the edge label with the rest of the key
+                var matchedIndex = keyIndex
+                var isMatched = true
+                while offset < size, basePointer[offset] != 0 {
+                    if isMatched {
+                        if matchedIndex < key.count,
+                           basePointer[offset] == key[matchedIndex] {
+                            matchedIndex += 1
+                        } else {
+                            isMatched = false
+                        }
+                    }
+                    offset += 1
+                }
+                offset += 1 // null terminator
+
+                guard offset < size else { return nil }
+                let (childOffset, ulebSize) = basePointer
+                    .advanced(by: offset)
+                    .readULEB128()
+                offset += ulebSize
+
+                if isMatched, matchedIndex > keyIndex {
+                    next = Int(childOffset)
+                    keyIndex = matchedIndex
+                    break
+                }
+            }
+
+            guard let next else { return nil }
+            nodeOffset = next
+        }
+
+        guard let terminalSize = self.terminalSize(ofNodeAt: nodeOffset),
+              terminalSize.value != 0 else {
+            return nil
+        }
+        return nodeOffset
+    }
+}
+
+extension _TrieTreeWalker {
+    private struct Frame {
+        /// Offset of the next child entry to read
+        var cursor: Int
+        /// Number of children not read yet
+        var remaining: Int
+        /// Length of the name up to this node
+        let nameLength: Int
+    }
+
+    /// Visit all terminal nodes in depth-first order.
+    ///
+    /// Nodes are visited in the same order as ``TrieTreeProtocol/_recurseTrie(currentName:entry:result:)``.
+    /// The trie is walked with an explicit stack, and a single buffer is reused for names,
+    /// so memory usage is proportional to the depth of the trie.
+    ///
+    /// - Parameter body: Closure called with the name and the offset of each terminal node.
+    ///                   The name buffer is only valid during the call.
+    ///                   Set `stop` to true to end the walk.
+    func forEachTerminal(
+        _ body: (
+            _ name: UnsafeBufferPointer<UInt8>,
+            _ nodeOffset: Int,
+            _ stop: inout Bool
+        ) throws -> Void
+    ) rethrows {
+        var name: [UInt8] = []
+        name.reserveCapacity(256)
+        var stack: [Frame] = []
+        var stop = false
+
+        var nextNodeOffset: Int? = 0
+
+        while true {
+            if let nodeOffset = nextNodeOffset,
+               let terminalSize = self.terminalSize(ofNodeAt: nodeOffset) {
+                nextNodeOffset = nil
+
+                if terminalSize.value != 0 {
+                    try name.withUnsafeBufferPointer {
+                        try body($0, nodeOffset, &stop)
+                    }
+                    if stop { return }
+                }
+
+                let childrenOffset = nodeOffset + terminalSize.size + Int(terminalSize.value)
+                // a valid trie is never deeper than its size
+                if childrenOffset < size, stack.count < size {
+                    stack.append(
+                        .init(
+                            cursor: childrenOffset + 1,
+                            remaining: Int(basePointer[childrenOffset]),
+                            nameLength: name.count
+                        )
+                    )
+                }
+            }
+
+            guard let frame = stack.last else { return }
+            guard frame.remaining > 0, frame.cursor < size else {
+                stack.removeLast()
+                continue
+            }
+
+            var offset = frame.cursor
+            let labelStart = offset
+            while offset < size, basePointer[offset] != 0 {
+                offset += 1
+            }
+            let labelEnd = offset
+            offset += 1 // null terminator
+            guard offset < size else {
+                stack.removeLast()
+                continue
+            }
+            let (childOffset, ulebSize) = basePointer
+                .advanced(by: offset)
+                .readULEB128()
+            offset += ulebSize
+
+            stack[stack.count - 1].cursor = offset
+            stack[stack.count - 1].remaining -= 1
+
+            name.removeSubrange(frame.nameLength...)
+            name.append(
+                contentsOf: UnsafeBufferPointer(
+                    start: basePointer.advanced(by: labelStart),
+                    count: labelEnd - labelStart
+                )
+            )
+            nextNodeOffset = Int(childOffset)
+        }
+    }
+}
+
+extension _TrieTreeWalker {
+    private struct Group {
+        let nodeOffset: Int
+        /// Range in the sorted order of keys
+        let range: Range<Int>
+        /// Length of the label up to the node
+        let depth: Int
+    }
+
+    /// Find the nodes whose full label is equal to each key, walking the trie once.
+    ///
+    /// Keys are sorted by bytes, so keys sharing a prefix form a contiguous range
+    /// and share the traversal down to the end of that prefix.
+    ///
+    /// - Parameter keys: UTF-8 bytes of the names to find
+    /// - Returns: Offsets of the found terminal nodes, in the same order as `keys`.
+    func terminalOffsets(
+        for keys: [[UInt8]]
+    ) -> [Int?] {
+        var results = [Int?](repeating: nil, count: keys.count)
+        guard !keys.isEmpty else { return results }
+
+        var order = Array(keys.indices)
+        let isSorted = zip(keys, keys.dropFirst()).allSatisfy {
+            !$1.lexicographicallyPrecedes($0)
+        }
+        if !isSorted {
+            order.sort { keys[$0].lexicographicallyPrecedes(keys[$1]) }
+        }
+
+        var stack: [Group] = [
+            .init(nodeOffset: 0, range: order.indices, depth: 0)
+        ]
+
+        while let group = stack.popLast() {
+            guard let terminalSize = self.terminalSize(ofNodeAt: group.nodeOffset) else {
+                continue
+            }
+
+            // Keys that end at this node are at the start of the range
+            var lower = group.range.lowerBound
+            while lower < group.range.upperBound,
+                  keys[order[lower]].count == group.depth {
+                if group.depth > 0, terminalSize.value != 0 {
+                    results[order[lower]] = group.nodeOffset
+                }
+                lower += 1
+            }
+            guard lower < group.range.upperBound else { continue }
+
+            var offset = group.nodeOffset + terminalSize.size + Int(terminalSize.value)
+            guard offset < size else { continue }
+
+            let numberOfChildren = basePointer[offset]
+            offset += 1
+
+            for _ in 0 ..< numberOfChildren where offset < size {
+                let labelStart = offset
+                while offset < size, basePointer[offset] != 0 {
+                    offset += 1
+                }
+                let label = UnsafeBufferPointer(
+                    start: basePointer.advanced(by: labelStart),
+                    count: offset - labelStart
+                )
+                offset += 1 // null terminator
+
+                guard offset < size else { break }
+                let (childOffset, ulebSize) = basePointer
+                    .advanced(by: offset)
+                    .readULEB128()
+                offset += ulebSize
+
+                guard let first = label.first else { continue }
+
+                // Keys in the range are sorted and longer than `depth`,
+                // so the bytes at `depth` are in ascending order.
+                let depth = group.depth
+                var start = lower
+                var end = group.range.upperBound
+                while start < end {
+                    let middle = start + (end - start) / 2
+                    if keys[order[middle]][depth] < first {
+                        start = middle + 1
+                    } else {
+                        end = middle
+                    }
+                }
+
+                // Keys matching the whole label are contiguous
+                var matchStart: Int?
+                var matchEnd = start
+                var position = start
+                while position < group.range.upperBound {
+                    let key = keys[order[position]]
+                    guard key[depth] == first else { break }
+                    let isMatched = key.count >= depth + label.count &&
+                        key[depth ..< depth + label.count].elementsEqual(label)
+                    if isMatched {
+                        if matchStart == nil { matchStart = position }
+                        matchEnd = position + 1
+                    } else if matchStart != nil {
+                        break
+                    }
+                    position += 1
+                }
+
+                if let matchStart {
+                    stack.append(
+                        .init(
+                            nodeOffset: Int(childOffset),
+                            range: matchStart ..< matchEnd,
+                            depth: depth + label.count
+                        )
+                    )
+                }
+            }
+        }
+
+        return results
+    }
+}
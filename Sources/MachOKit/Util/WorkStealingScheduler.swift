@@ -0,0 +1,126 @@
+//
+//  WorkStealingScheduler.swift
+//  MachOKit
+//
+//  Created by p-x9 on 2026/10/17
+//
+//
+
+import Foundation
+
+/// Runs indexed work items on multiple threads with work stealing.
+///
+/// Each worker starts with a contiguous range of indices and takes items from its front.
+/// A worker that runs out of items steals the back half of the largest remaining range,
+/// so a few expensive items do not leave the other workers idle.
+enum WorkStealingScheduler {
+    /// Call `body` once for every index in `0 ..< count`.
+    ///
+    /// Returns after all items are processed.
+    /// - Parameters:
+    ///   - count: Number of work items
+    ///   - maxConcurrency: Maximum number of workers
+    ///   - body: Work for the item at the index. Called from multiple threads.
+    static func run(
+        count: Int,
+        maxConcurrency: Int,
+        _ body: (Int) -> Void
+    ) {
+        guard count > 0 else { return }
+
+        let workerCount = min(max(1, maxConcurrency), count)
+        if workerCount == 1 {
+            for i in 0 ..< count { body(i) }
+            return
+        }
+
+        let queues: [Queue] = (0 ..< workerCount).map { worker in
+            .init(
+                lower: count * worker / workerCount,
+                upper: count * (worker + 1) / workerCount
+            )
+        }
+
+        DispatchQueue.concurrentPerform(iterations: workerCount) { worker in
+            let queue = queues[worker]
+            while true {
+                while let index = queue.popFirst() {
+                    body(index)
+                }
+                guard let stolen = steal(for: worker, from: queues) else {
+                    return
+                }
+                queue.reset(to: stolen)
+            }
+        }
+    }
+
+    /// Steal items from the worker with the most remaining items.
+    private static func steal(
+        for worker: Int,
+        from queues: [Queue]
+    ) -> Range<Int>? {
+        while true {
+            var victim: Queue?
+            var victimCount = 0
+            for offset in 1 ..< queues.count {
+                let queue = queues[(worker + offset) % queues.count]
+                let count = queue.count
+                if count > victimCount {
+                    victim = queue
+                    victimCount = count
+                }
+            }
+            guard let victim else { return nil }
+            // The victim may have drained meanwhile, so look again
+            if let stolen = victim.stealHalf() {
+                return stolen
+            }
+        }
+    }
+}
+
+extension WorkStealingScheduler {
+    /// Range of remaining indices owned by one worker
+    private final class Queue: @unchecked Sendable {
+        private let lock = NSLock()
+        private var lower: Int
+        private var upper: Int
+
+        init(lower: Int, upper: Int) {
+            self.lower = lower
+            self.upper = upper
+        }
+
+        var count: Int {
+            lock.lock()
+            defer { lock.unlock() }
+            return upper - lower
+        }
+
+        func popFirst() -> Int? {
+            lock.lock()
+            defer { lock.unlock() }
+            guard lower < upper else { return nil }
+            defer { lower += 1 }
+            return lower
+        }
+
+        func stealHalf() -> Range<Int>? {
+            lock.lock()
+            defer { lock.unlock() }
+            let remaining = upper - lower
+            guard remaining > 0 else { return nil }
+            let newUpper = upper - (remaining + 1) / 2
+            defer { upper = newUpper }
+            return newUpper ..< upper
+        }
+
+        func reset(to range: Range<Int>) {
+            lock.lock()
+            defer { lock.unlock() }
+            lower = range.lowerBound
+            upper = range.upperBound
+        }
+    }
+}
@@ -88,6 +88,27 @@ struct objc_image_info {
     uint32_t flags;
 };
 
+// https://github.com/apple-oss-distributions/dyld/blob/65bbeed63cec73f313b1d636e63f243964725a9d/common/ObjCStringTable.h
+// Header of objc::StringHashTable (selector table) and objc::ObjectHashTable (class/protocol table)
+struct objc_string_hash_table {
+    uint32_t capacity;
+    uint32_t occupied;
+    uint32_t shift;
+    uint32_t mask;
+    int32_t sentinelTarget;
+    uint32_t roundedTabSize;
+    uint64_t salt;
+    // uint32_t scramble[256];
+    // uint8_t tab[roundedTabSize];  /* tab[mask+1] (always power-of-2). Rounded up to roundedTabSize */
+    // uint8_t checkbytes[capacity]; /* check byte for each string */
+    // int32_t offsets[capacity];    /* offsets from start of table to cstrings */
+    //
+    // ObjectHashTable only:
+    // uint64_t objectOffsets[capacity];    /* isDuplicate:1, objectCacheOffset:47, dylibObjCIndex:16 */
+    // uint32_t duplicateCount;
+    // uint64_t duplicateOffsets[duplicateCount];
+};
+
 // https://github.com/apple-oss-distributions/dyld/blob/65bbeed63cec73f313b1d636e63f243964725a9d/include/objc-shared-cache.h#L93
 struct /*alignas(alignof(uint64_t)) */objc_opt_t_16 {
     uint32_t version; // = 16
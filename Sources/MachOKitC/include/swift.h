@@ -10,6 +10,7 @@
 #define swift_h
 
 #include <stdint.h>
+#include "objc.h"
 
 // ref: https://github.com/apple-oss-distributions/dyld/blob/031f1c6ffb240a094f3f2f85f20dfd9e3f15b664/common/OptimizerSwift.h#L45
 struct swift_optimization {
@@ -26,4 +27,36 @@ struct swift_optimization {
     uint64_t prespecializedMetadataHashTableCacheOffsets[8]; // added in version 3
 };
 
+// ref: https://github.com/apple-oss-distributions/dyld/blob/031f1c6ffb240a094f3f2f85f20dfd9e3f15b664/common/OptimizerSwift.h
+// SwiftHashTable has the same header, tab and offsets as objc::StringHashTable.
+// offsets[capacity] point to the locations below, from start of table.
+typedef struct objc_string_hash_table swift_hash_table;
+
+// Location of a protocol conformance in the cache.
+// If nextIsDuplicate is set, another location with the same key follows this one.
+struct swift_protocol_conformance_location {
+    uint64_t nextIsDuplicate                : 1;
+    uint64_t protocolConformanceCacheOffset : 47;
+    uint64_t dylibObjCIndex                 : 16;
+};
+
+struct swift_type_protocol_conformance_location {
+    struct swift_protocol_conformance_location location;
+    uint64_t typeDescriptorCacheOffset;
+    uint64_t protocolCacheOffset;
+};
+
+struct swift_metadata_protocol_conformance_location {
+    struct swift_protocol_conformance_location location;
+    uint64_t metadataCacheOffset;
+    uint64_t protocolCacheOffset;
+};
+
+struct swift_foreign_type_protocol_conformance_location {
+    struct swift_protocol_conformance_location location;
+    uint64_t foreignDescriptorNameCacheOffset;
+    uint64_t foreignDescriptorNameLength;
+    uint64_t protocolCacheOffset;
+};
+
 #endif /* swift_h */
@@ -273,6 +273,29 @@ final class DyldCacheLoadedPrintTests: XCTestCase {
         }
     }
 
+    func testObjCHashTables() throws {
+        guard let objcOptimization = cache.objcOptimization else { return }
+
+        if let selectors = objcOptimization.selectorHashTable(in: cache) {
+            print("Selectors:", selectors.occupied, "/", selectors.capacity)
+            let entry = selectors.entry(named: "alloc", in: cache)
+            XCTAssertNotNil(entry)
+            print(" alloc, offset: \(entry?.offset ?? -1)")
+        }
+
+        if let classes = objcOptimization.classHashTable(in: cache) {
+            print("Classes:", classes.occupied, "/", classes.capacity)
+            for object in classes.objects(named: "NSObject", in: cache) {
+                print(" NSObject, offset: \(object.offset), imageIndex: \(object.imageIndex)")
+            }
+        }
+
+        if let protocols = objcOptimization.protocolHashTable(in: cache) {
+            print("Protocols:", protocols.occupied, "/", protocols.capacity)
+            print(" count:", Array(protocols.objects(in: cache)).count)
+        }
+    }
+
     func testObjCHeaderOptimizationRW() throws {
         guard let objcOptimization = cache.objcOptimization else { return }
         let rw = objcOptimization.headerOptimizationRW64(in: cache)!
@@ -332,6 +355,18 @@ final class DyldCacheLoadedPrintTests: XCTestCase {
         print("Prespecialized Metadata Hash Table Cache Offset:", swiftOptimization.prespecializedMetadataHashTableCacheOffsets)
     }
 
+    func testSwiftConformanceHashTables() throws {
+        guard let swiftOptimization = cache.swiftOptimization,
+              let table = swiftOptimization.typeConformanceHashTable(in: cache) else {
+            return
+        }
+        print("Type Conformances:", table.occupied, "/", table.capacity)
+        let byType = table.conformancesByConformingType(in: cache)
+        print("Conforming Types:", byType.count)
+        for (type, conformances) in byType.prefix(10) {
+            print(" \(type): \(conformances.map(\.protocolOffset))")
+        }
+    }
 
     func testDynamicData() throws {
         guard let dynamicData = cache.dynamicData else { return }
@@ -80,6 +80,107 @@ final class DyldCachePrintTests: XCTestCase {
         }
     }
 
+    func testMappingInfoLookup() throws {
+        guard let infos = cache.mappingInfos else {
+            return
+        }
+        for info in infos {
+            let last = info.address + info.size - 1
+            XCTAssertEqual(cache.mappingInfo(for: info.address)?.address, info.address)
+            XCTAssertEqual(cache.mappingInfo(for: last)?.address, info.address)
+            XCTAssertEqual(
+                cache.mappingInfo(forFileOffset: info.fileOffset)?.fileOffset,
+                info.fileOffset
+            )
+            XCTAssertEqual(
+                cache.fileOffset(of: last).flatMap(cache.address(of:)),
+                last
+            )
+        }
+        if let last = infos.max(by: { $0.address < $1.address }) {
+            XCTAssertNil(cache.mappingInfo(for: last.address + last.size))
+        }
+    }
+
+    func testSlideRebases() throws {
+        guard let infos = cache.mappingAndSlideInfos else {
+            return
+        }
+        for info in infos {
+            guard let rebases = cache.rebases(in: info) else {
+                continue
+            }
+            print("----")
+            print("Name:", info.mappingName ?? "unknown")
+            print("Pages:", rebases.numberOfPages)
+
+            let pageIndices = 0 ..< min(rebases.numberOfPages, 16)
+            for pageIndex in pageIndices {
+                for rebase in rebases.rebases(inPage: pageIndex) {
+                    XCTAssertEqual(
+                        cache.resolveRebase(at: rebase.fileOffset),
+                        rebase.target
+                    )
+                }
+            }
+
+            let expected = pageIndices.flatMap {
+                rebases.rebases(inPage: $0)
+            }
+            XCTAssertEqual(
+                Array(rebases.prefix(expected.count)),
+                expected
+            )
+        }
+    }
+
+    func testSlideInfo4Resolve() throws {
+        var layout = dyld_cache_slide_info4()
+        layout.version = 4
+        layout.delta_mask = 0xC0000000
+        layout.value_add = 0x1A000000
+        let slideInfo = DyldCacheSlideInfo4(layout: layout, offset: 0)
+
+        // small positive value with delta bits
+        var resolved = slideInfo._resolve(rawValue: 0x40001234)
+        XCTAssertEqual(resolved.value, 0x1234)
+        XCTAssertFalse(resolved.isRebase)
+
+        // small negative value
+        resolved = slideInfo._resolve(rawValue: 0x3FFFFFF0)
+        XCTAssertEqual(resolved.value, 0xFFFFFFF0)
+        XCTAssertFalse(resolved.isRebase)
+
+        // pointer
+        resolved = slideInfo._resolve(rawValue: 0x80123456)
+        XCTAssertEqual(resolved.value, 0x00123456 + 0x1A000000)
+        XCTAssertTrue(resolved.isRebase)
+    }
+
+    func testSlidView() throws {
+        guard let infos = cache.mappingAndSlideInfos else {
+            return
+        }
+        let slide: UInt64 = 0x4000
+        let view = try XCTUnwrap(cache.slidView(slide: slide, maxPageCount: 4))
+        for info in infos {
+            guard let rebases = cache.rebases(in: info) else {
+                continue
+            }
+            for rebase in rebases.prefix(64) {
+                guard let address = cache.address(of: rebase.fileOffset) else {
+                    XCTFail("address not found")
+                    continue
+                }
+                XCTAssertEqual(
+                    view.readPointer(at: address),
+                    rebase.target + slide
+                )
+            }
+            XCTAssertLessThanOrEqual(view.materializedPageCount, 4)
+        }
+    }
+
     func testImageInfos() throws {
         guard let infos = cache.imageInfos else {
             return
@@ -174,6 +275,41 @@ final class DyldCachePrintTests: XCTestCase {
         }
     }
 
+    func testImageLocalSymbols() throws {
+        guard let symbolCache = try cache.symbolCache,
+              let info = symbolCache.localSymbolsInfo,
+              let index = symbolCache.localSymbolsEntryIndex else {
+            return
+        }
+        XCTAssertTrue(index.isBuilt(from: info))
+        let entries = Array(info.entries(in: symbolCache))
+        let imageLocalSymbols = try cache.imageLocalSymbols()
+
+        for machO in cache.machOFiles().prefix(10) {
+            guard let text = machO.segments.first(where: { $0.segmentName == SEG_TEXT }) else {
+                XCTFail("No __TEXT segment in \(machO.imagePath)")
+                continue
+            }
+            let textAddress: UInt64 = numericCast(text.virtualMemoryAddress)
+            let dylibOffset: Int = info.is64BitEntryFormat(in: symbolCache)
+                ? numericCast(textAddress - cache.mainCacheHeader.sharedRegionStart)
+                : machO.headerStartOffsetInCache
+            guard let expected = entries.first(where: { $0.dylibOffset == dylibOffset }) else {
+                XCTFail("No local symbols entry for \(machO.imagePath)")
+                continue
+            }
+
+            let entry = info.entry(for: machO, in: symbolCache)
+            XCTAssertEqual(entry?.dylibOffset, expected.dylibOffset)
+            XCTAssertEqual(entry?.nlistStartIndex, expected.nlistStartIndex)
+            XCTAssertEqual(entry?.nlistCount, expected.nlistCount)
+
+            let localSymbols = imageLocalSymbols.first(where: { $0.imagePath == machO.imagePath })
+            XCTAssertEqual(localSymbols?.entry.dylibOffset, expected.dylibOffset)
+            XCTAssertEqual(localSymbols?.entry.nlistCount, expected.nlistCount)
+        }
+    }
+
     func testMachOFiles() throws {
         let machOs = cache.machOFiles()
         for machO in machOs {
@@ -321,6 +457,48 @@ final class DyldCachePrintTests: XCTestCase {
         }
     }
 
+    func testObjCHashTables() throws {
+        guard let objcOptimization = cache.objcOptimization else { return }
+
+        if let selectors = objcOptimization.selectorHashTable(in: cache) {
+            print("Selectors:", selectors.occupied, "/", selectors.capacity)
+            for entry in selectors.entries(in: cache)!.prefix(10) {
+                XCTAssertEqual(selectors.entry(named: entry.name, in: cache), entry)
+                print(" \(entry.name), offset: \(entry.offset)")
+            }
+            XCTAssertNil(selectors.entry(named: "__MachOKit_no_such_selector:", in: cache))
+        }
+
+        if let classes = objcOptimization.classHashTable(in: cache) {
+            print("Classes:", classes.occupied, "/", classes.capacity)
+            let ro = objcOptimization.headerOptimizationRO64(in: cache)
+            for object in classes.objects(named: "NSObject", in: cache) {
+                let path = ro?.headerInfos(in: cache)?
+                    .first(where: { $0.index == object.imageIndex })?
+                    .machO(in: cache)?
+                    .imagePath
+                print(" NSObject, offset: \(object.offset), image: \(path ?? "nil")")
+            }
+            XCTAssertTrue(classes.objects(named: "__MachOKit_NoSuchClass", in: cache).isEmpty)
+
+            // duplicated classes
+            for object in classes.objects(in: cache)!.prefix(100) {
+                let objects = classes.objects(named: object.name, in: cache)
+                XCTAssertTrue(objects.contains(object))
+                if objects.count > 1 {
+                    print(" \(object.name) x \(objects.count)")
+                }
+            }
+        }
+
+        if let protocols = objcOptimization.protocolHashTable(in: cache) {
+            print("Protocols:", protocols.occupied, "/", protocols.capacity)
+            for object in protocols.objects(named: "NSObject", in: cache) {
+                print(" <NSObject>, offset: \(object.offset), imageIndex: \(object.imageIndex)")
+            }
+        }
+    }
+
     func testSwiftOptimization() throws {
         guard let swiftOptimization = cache.swiftOptimization else { return }
         print("Version:", swiftOptimization.version)
@@ -332,6 +510,42 @@ final class DyldCachePrintTests: XCTestCase {
         print("Prespecialized Metadata Hash Table Cache Offset:", swiftOptimization.prespecializedMetadataHashTableCacheOffsets)
     }
 
+    func testSwiftConformanceHashTables() throws {
+        guard let swiftOptimization = cache.swiftOptimization else { return }
+
+        if let table = swiftOptimization.typeConformanceHashTable(in: cache) {
+            print("Type Conformances:", table.occupied, "/", table.capacity)
+            for conformance in table.conformances(in: cache)!.prefix(10) {
+                guard case let .typeDescriptor(offset) = conformance.conformingType else {
+                    XCTFail("unexpected conforming type")
+                    continue
+                }
+                let found = table.conformances(
+                    conformingTypeOffset: offset,
+                    protocolOffset: conformance.protocolOffset,
+                    in: cache
+                )
+                XCTAssertTrue(found.contains(conformance))
+                print(" type: \(offset), protocol: \(conformance.protocolOffset), conformance: \(conformance.conformanceOffset)")
+            }
+        }
+
+        if let table = swiftOptimization.metadataConformanceHashTable(in: cache) {
+            print("Metadata Conformances:", table.occupied, "/", table.capacity)
+        }
+
+        if let table = swiftOptimization.foreignTypeConformanceHashTable(in: cache) {
+            print("Foreign Type Conformances:", table.occupied, "/", table.capacity)
+            for conformance in table.conformances(in: cache)!.prefix(10) {
+                guard case let .foreignTypeName(offset, length) = conformance.conformingType else {
+                    XCTFail("unexpected conforming type")
+                    continue
+                }
+                print(" name: \(offset) (\(length) bytes), protocol: \(conformance.protocolOffset)")
+            }
+        }
+    }
+
     func testTproMappings() throws {
         guard let mappings = cache.tproMappings else { return }
         for mapping in mappings {
@@ -77,6 +77,107 @@ final class FullDyldCachePrintTests: XCTestCase {
         }
     }
 
+    func testSharedCacheWrappers() throws {
+        XCTAssertTrue(cache.mainCache === cache.mainCache)
+        for (lhs, rhs) in zip(cache.subCaches, cache.subCaches) {
+            XCTAssertTrue(lhs === rhs)
+            XCTAssertTrue(lhs.mainCache === cache.mainCache)
+        }
+
+        // MachO retains the full cache, and the wrappers do not retain it in a cycle
+        weak var weakFullCache: FullDyldCache?
+        var machO: MachOFile?
+        do {
+            let fullCache = try FullDyldCache(url: cache.url)
+            weakFullCache = fullCache
+            var iterator = fullCache.machOFiles().makeIterator()
+            machO = iterator.next()
+        }
+        guard machO != nil else { return }
+        XCTAssertNotNil(weakFullCache)
+        XCTAssertTrue(machO?.fullCache === weakFullCache)
+        machO = nil
+        XCTAssertNil(weakFullCache)
+    }
+
+    func testSharedCacheWrapperOutlivesFullCache() throws {
+        weak var weakFullCache: FullDyldCache?
+        var mainCache: DyldCache?
+        var subCache: DyldCache?
+        var expectedImagePaths: [String] = []
+        do {
+            let fullCache = try FullDyldCache(url: cache.url)
+            weakFullCache = fullCache
+            mainCache = fullCache.mainCache
+            subCache = fullCache.subCaches.first
+            expectedImagePaths = fullCache.mainCache.machOFiles().prefix(16).map(\.imagePath)
+        }
+        // Wrappers do not keep the full cache alive
+        XCTAssertNil(weakFullCache)
+
+        guard let mainCache else { return }
+        // The mappings retained by the wrapper are still readable
+        XCTAssertEqual(mainCache.header.magic, cache.header.magic)
+        XCTAssertEqual(
+            mainCache.machOFiles().prefix(16).map(\.imagePath),
+            expectedImagePaths
+        )
+        if let subCache {
+            XCTAssertEqual(subCache.url, cache.urls[1])
+            XCTAssertEqual(subCache.header.magic, cache.subCaches.first?.header.magic)
+            XCTAssertTrue(subCache.mainCache === mainCache)
+        }
+
+        // The full cache is assembled again from the same files
+        let fullCache = try XCTUnwrap(mainCache.fullCache)
+        XCTAssertEqual(fullCache.url, cache.url)
+        XCTAssertEqual(fullCache.urls, cache.urls)
+        XCTAssertTrue(mainCache.fullCache === fullCache)
+        XCTAssertEqual(
+            fullCache.mainCache.machOFiles().prefix(16).map(\.imagePath),
+            expectedImagePaths
+        )
+    }
+
+    func testLazyFullDyldCache() throws {
+        let lazyCache = try LazyFullDyldCache(
+            url: cache.url,
+            maxMappedSubCaches: 2
+        )
+        XCTAssertEqual(lazyCache.mappedSubCacheCount, 0)
+        XCTAssertEqual(
+            lazyCache.subCacheURLs,
+            Array(cache.urls.dropFirst())
+        )
+
+        for machO in cache.machOFiles().prefix(64) {
+            let lazyMachO = lazyCache.machOFile(forInstallName: machO.imagePath)
+            XCTAssertEqual(lazyMachO?.imagePath, machO.imagePath)
+            XCTAssertEqual(lazyMachO?.header.ncmds, machO.header.ncmds)
+            XCTAssertLessThanOrEqual(lazyCache.mappedSubCacheCount, 2)
+        }
+
+        if let infos = cache.mappingInfos {
+            for info in infos {
+                XCTAssertNotNil(lazyCache.cache(containing: info.address))
+            }
+        }
+        XCTAssertLessThanOrEqual(lazyCache.mappedSubCacheCount, 2)
+
+        let expectedSymbolCache = try cache.symbolCache
+        let symbolCache = try lazyCache.symbolCache
+        XCTAssertEqual(symbolCache?.url, expectedSymbolCache?.url)
+        XCTAssertEqual(
+            symbolCache?.localSymbolsInfo?.layout.entriesCount,
+            expectedSymbolCache?.localSymbolsInfo?.layout.entriesCount
+        )
+        // opened once and reused
+        XCTAssertTrue(try lazyCache.symbolCache === symbolCache)
+
+        lazyCache.unmapSubCaches()
+        XCTAssertEqual(lazyCache.mappedSubCacheCount, 0)
+    }
+
     func testImageInfos() throws {
         guard let infos = cache.imageInfos else {
             return
@@ -188,6 +289,73 @@ final class FullDyldCachePrintTests: XCTestCase {
         }
     }
 
+    func testMachOFileForInstallName() throws {
+        for machO in cache.machOFiles().prefix(32) {
+            let found = cache.machOFile(forInstallName: machO.imagePath)
+            XCTAssertEqual(found?.imagePath, machO.imagePath)
+            XCTAssertEqual(found?.url, machO.url)
+            XCTAssertEqual(
+                found?.headerStartOffsetInCache,
+                machO.headerStartOffsetInCache
+            )
+        }
+        for dylibIndex in cache.dylibIndices {
+            let info = cache.imageInfo(forInstallName: dylibIndex.name)
+            XCTAssertNotNil(info)
+            if info?.path(in: cache) != dylibIndex.name {
+                print("Alias:", dylibIndex.name, "->", info?.path(in: cache) ?? "unknown")
+            }
+        }
+        XCTAssertNil(cache.machOFile(forInstallName: "/usr/lib/__machokit_missing__.dylib"))
+    }
+
+    func testConcurrentMapMachOFiles() throws {
+        let serial = cache.machOFiles().map(\.imagePath)
+        let concurrent = cache.concurrentMapMachOFiles(\.imagePath)
+        XCTAssertEqual(concurrent.compactMap { $0 }, serial)
+
+        // results line up with image infos
+        let imageInfos = cache.imageInfos.map { Array($0) } ?? []
+        XCTAssertEqual(concurrent.count, imageInfos.count)
+        for (info, imagePath) in zip(imageInfos, concurrent) {
+            guard let imagePath else { continue }
+            XCTAssertEqual(imagePath, info.path(in: cache))
+        }
+
+        let lock = NSLock()
+        var count = 0
+        cache.concurrentForEachMachOFile { machO in
+            _ = machO.header.ncmds
+            lock.lock()
+            count += 1
+            lock.unlock()
+        }
+        XCTAssertEqual(count, serial.count)
+    }
+
+    func testSymbolicator() throws {
+        let symbolicator = try cache.makeSymbolicator()
+        print("Images:", symbolicator.imageCount)
+
+        for machO in cache.machOFiles().prefix(10) {
+            guard let symbol = machO.exportedSymbols.first(where: { $0.offset != nil && $0.flags.kind == .regular }),
+                  let offset = symbol.offset,
+                  let text = machO.segments.first(where: { $0.segmentName == SEG_TEXT }) else {
+                continue
+            }
+            let address = UInt64(text.virtualMemoryAddress + offset)
+            let result = symbolicator.symbolicate(address)
+            XCTAssertEqual(result?.imagePath, machO.imagePath)
+            XCTAssertEqual(result?.symbolAddress, address)
+            print(result?.imagePath ?? "", result?.symbolName ?? "", result?.symbolOffset ?? 0)
+
+            XCTAssertEqual(
+                symbolicator.symbolicate([address, 0, address]).map { $0?.symbolAddress },
+                [address, nil, address]
+            )
+        }
+    }
+
     func testDyld() throws {
         guard let dyld = cache.dyld else { return }
         let sourceVersion = dyld.loadCommands.info(of: LoadCommand.sourceVersion)!
@@ -58,6 +58,25 @@ final class MachOFilePrintTests: XCTestCase {
         }
     }
 
+    func testLoadCommandsIndex() throws {
+        let loadCommands = machO.loadCommands
+        XCTAssertEqual(
+            loadCommands.infos(of: LoadCommand.segment64).map(\.offset),
+            loadCommands._infos(of: LoadCommand.segment64).map(\.offset)
+        )
+        XCTAssertEqual(
+            loadCommands.info(of: LoadCommand.loadDylib)?.offset,
+            loadCommands._infos(of: LoadCommand.loadDylib).first(where: { _ in true })?.offset
+        )
+        XCTAssertEqual(
+            Array(loadCommands.of(.loadDylib)).count,
+            Array(loadCommands._of(.loadDylib)).count
+        )
+        XCTAssertEqual(loadCommands.symtab?.offset, loadCommands.info(of: LoadCommand.symtab)?.offset)
+        XCTAssertEqual(loadCommands.dysymtab?.offset, loadCommands.info(of: LoadCommand.dysymtab)?.offset)
+        XCTAssertEqual(loadCommands.text64?.offset, machO.segments64.first(where: { $0.segname == SEG_TEXT })?.offset)
+    }
+
     func testSegments() throws {
         for segment in machO.segments {
             print("----")
@@ -272,6 +291,14 @@ final class MachOFilePrintTests: XCTestCase {
         }
     }
 
+    func testBorrowedSymbols() throws {
+        guard let symbols64 = machO.symbols64 else { return }
+        for (symbol, borrowed) in zip(symbols64, symbols64.borrowed) {
+            XCTAssertEqual(symbol.name, borrowed.name)
+            XCTAssertEqual(symbol.offset, borrowed.offset)
+        }
+    }
+
     func testIndirectSymbols() throws {
         guard let _indirectSymbols = machO.indirectSymbols else { return }
         let symbols = machO.symbols
@@ -561,6 +588,43 @@ extension MachOFilePrintTests {
     }
 }
 
+extension MachOFilePrintTests {
+    func testClosestSymbolWithAddressIndex() {
+        guard let index = machO.symbolAddressIndex else {
+            XCTFail("failed to build symbol address index")
+            return
+        }
+        // Fixed distances past each symbol, so that failures are reproducible
+        for (i, symbol) in machO.symbols.enumerated() {
+            let offset = symbol.offset + (i * 37) % 100
+            let expected = machO.closestSymbol(at: offset)
+            let indexed = machO.closestSymbol(at: offset, using: index)
+            XCTAssertEqual(expected?.name, indexed?.name)
+            XCTAssertEqual(expected?.offset, indexed?.offset)
+
+            let expectedSymbols = machO.closestSymbols(at: offset, isGlobalOnly: true)
+            let indexedSymbols = machO.closestSymbols(at: offset, isGlobalOnly: true, using: index)
+            XCTAssertEqual(expectedSymbols.map(\.name), indexedSymbols.map(\.name))
+        }
+    }
+}
+
+extension MachOFilePrintTests {
+    func testClosestSymbolsForOffsets() {
+        // Fixed distances past each symbol, in reverse symbol table order
+        let offsets = machO.symbols.enumerated().map { i, symbol in
+            symbol.offset + (i * 37) % 100
+        }.reversed() as [Int]
+        let symbols = machO.closestSymbols(forOffsets: offsets)
+        XCTAssertEqual(symbols.count, offsets.count)
+        for (offset, symbol) in zip(offsets, symbols) {
+            let expected = machO.closestSymbol(at: offset)
+            XCTAssertEqual(expected?.name, symbol?.name)
+            XCTAssertEqual(expected?.offset, symbol?.offset)
+        }
+    }
+}
+
 extension MachOFilePrintTests {
     func testFindSymbolByName() {
         let name = "$ss9CodingKeyP9CoherenceAC15IntCaseIterableRzs0eF0RzrlE8intCasesShySiGvgZ"
@@ -587,6 +651,145 @@ extension MachOFilePrintTests {
     }
 }
 
+extension MachOFilePrintTests {
+    func testFindSymbolByNameWithNameIndex() {
+        guard let index = machO.symbolNameIndex else {
+            XCTFail("failed to build symbol name index")
+            return
+        }
+        let symbols = Array(machO.symbols)
+        let step = max(1, symbols.count / 200)
+        for symbol in stride(from: 0, to: symbols.count, by: step).map({ symbols[$0] }) {
+            var names = [symbol.name, "_" + symbol.name]
+            if symbol.name.hasPrefix("_") {
+                names.append(String(symbol.name.dropFirst()))
+            }
+            for name in names {
+                let expected = machO.symbols(named: name)
+                let indexed = machO.symbols(named: name, using: index)
+                XCTAssertEqual(expected.map(\.name), indexed.map(\.name), name)
+                XCTAssertEqual(expected.map(\.offset), indexed.map(\.offset), name)
+
+                for isGlobalOnly in [false, true] {
+                    let expectedSymbol = machO.symbol(named: name, isGlobalOnly: isGlobalOnly)
+                    let indexedSymbol = machO.symbol(named: name, isGlobalOnly: isGlobalOnly, using: index)
+                    XCTAssertEqual(expectedSymbol?.name, indexedSymbol?.name, name)
+                    XCTAssertEqual(expectedSymbol?.offset, indexedSymbol?.offset, name)
+                }
+            }
+        }
+    }
+}
+
+extension MachOFilePrintTests {
+    func testFindSymbolByNameWithDemangledNameCache() {
+        let demangledName = "async function pointer to dispatch thunk of Swift.Clock.sleep(until: A.Instant, tolerance: Swift.Optional<A.Duration>) async throws -> ()"
+
+        let cache = machO.demangledNameCache
+        machO.demangleSymbolNames(into: cache)
+        XCTAssertGreaterThan(cache.count, 0)
+
+        let expected = machO.symbols(named: demangledName, mangled: false)
+        let cached = machO.symbols(named: demangledName, mangled: false, using: cache)
+        XCTAssertEqual(expected.map(\.name), cached.map(\.name))
+        XCTAssertEqual(expected.map(\.offset), cached.map(\.offset))
+
+        let expectedSymbol = machO.symbol(named: demangledName, mangled: false)
+        let cachedSymbol = machO.symbol(named: demangledName, mangled: false, using: cache)
+        XCTAssertEqual(expectedSymbol?.name, cachedSymbol?.name)
+        XCTAssertEqual(expectedSymbol?.offset, cachedSymbol?.offset)
+    }
+}
+
+extension MachOFilePrintTests {
+    func testExportTrieSearchMiss() throws {
+        guard let exportTrie = machO.exportTrie else { return }
+        for symbol in machO.exportedSymbols.prefix(100) {
+            XCTAssertNil(exportTrie.search(by: symbol.name + "__machokit_missing__"))
+            if symbol.name.count > 1,
+               !machO.exportedSymbols.contains(where: { $0.name == String(symbol.name.dropLast()) }) {
+                XCTAssertNil(exportTrie.search(by: String(symbol.name.dropLast())))
+            }
+        }
+    }
+}
+
+extension MachOFilePrintTests {
+    func testForEachExportedSymbol() throws {
+        guard let exportTrie = machO.exportTrie,
+              let root = exportTrie.wrapped.first(where: { _ in true }) else {
+            return
+        }
+        var terminals: [(String, ExportTrieNodeContent)] = []
+        exportTrie.wrapped._recurseTrie(currentName: "", entry: root, result: &terminals)
+        let expectedNames = terminals.map(\.0)
+        let expectedOffsets = terminals.map { _, content in
+            content.symbolOffset.map { Int(bitPattern: $0) }
+        }
+
+        // raw bytes walker, and node decoding fallback
+        let visitedSymbols = [
+            exportedSymbols(visiting: exportTrie.wrapped),
+            exportedSymbols(visiting: NodeOnlyTrieTree(base: exportTrie.wrapped))
+        ]
+        for visited in visitedSymbols {
+            XCTAssertEqual(visited.map(\.name), expectedNames)
+            XCTAssertEqual(visited.map(\.offset), expectedOffsets)
+        }
+
+        var count = 0
+        exportTrie.forEachExportedSymbol { _, stop in
+            count += 1
+            stop = count == 10
+        }
+        XCTAssertEqual(count, min(10, terminals.count))
+    }
+
+    private func exportedSymbols<Trie: TrieTreeProtocol>(
+        visiting trie: Trie
+    ) -> [ExportedSymbol] where Trie.Content == ExportTrieNodeContent {
+        var symbols: [ExportedSymbol] = []
+        trie.forEachExportedSymbol { symbol, _ in
+            symbols.append(symbol)
+        }
+        return symbols
+    }
+}
+
+/// Trie tree that does not provide its raw bytes,
+/// so that nodes are decoded one at a time
+private struct NodeOnlyTrieTree<Base: TrieTreeProtocol>: TrieTreeProtocol {
+    typealias Content = Base.Content
+
+    let base: Base
+
+    func element(atOffset offset: Int) -> Base.Element? {
+        base.element(atOffset: offset)
+    }
+
+    func makeIterator() -> Base.Iterator {
+        base.makeIterator()
+    }
+}
+
+extension MachOFilePrintTests {
+    func testExportTrieBatchSearch() throws {
+        guard let exportTrie = machO.exportTrie else { return }
+        var keys = machO.exportedSymbols.prefix(1_000).map(\.name)
+        keys += keys.prefix(10).map { $0 + "__machokit_missing__" }
+        keys += ["", "_"]
+        keys.shuffle()
+
+        let found = exportTrie.search(byKeys: keys)
+        XCTAssertEqual(found.count, keys.count)
+        for (key, symbol) in zip(keys, found) {
+            let expected = exportTrie.search(by: key)
+            XCTAssertEqual(symbol?.name, expected?.name)
+            XCTAssertEqual(symbol?.offset, expected?.offset)
+        }
+    }
+}
+
 extension MachOFilePrintTests {
     func testFunctionStarts() {
         guard let functionStarts = machO.functionStarts else { return }
@@ -703,6 +906,285 @@ extension MachOFilePrintTests {
             }
         }
     }
+
+    func testChainedFixUpPointerVisitor() {
+        guard let chainedFixups = machO.dyldChainedFixups,
+            let startsInImage = chainedFixups.startsInImage else {
+            return
+        }
+        let startsInSegments = chainedFixups.startsInSegments(of: startsInImage)
+        let expected = startsInSegments.flatMap {
+            chainedFixups.pointers(of: $0, in: machO)
+        }
+
+        var pointers: [DyldChainedFixupPointer] = []
+        chainedFixups.forEachPointer(in: machO) { pointer, _ in
+            pointers.append(pointer)
+        }
+        XCTAssertEqual(pointers.map(\.offset), expected.map(\.offset))
+        XCTAssertEqual(
+            pointers.map { $0.fixupInfo.rebase?.target },
+            expected.map { $0.fixupInfo.rebase?.target }
+        )
+        XCTAssertEqual(
+            pointers.map { $0.fixupInfo.bind?.ordinal },
+            expected.map { $0.fixupInfo.bind?.ordinal }
+        )
+
+        var rebaseCount = 0
+        chainedFixups.forEachPointer(in: machO, filter: .rebase) { pointer, _ in
+            XCTAssertNotNil(pointer.fixupInfo.rebase)
+            rebaseCount += 1
+        }
+        var bindCount = 0
+        chainedFixups.forEachPointer(in: machO, filter: .bind) { pointer, _ in
+            XCTAssertNotNil(pointer.fixupInfo.bind)
+            bindCount += 1
+        }
+        XCTAssertEqual(rebaseCount, expected.filter { $0.fixupInfo.rebase != nil }.count)
+        XCTAssertEqual(bindCount, expected.filter { $0.fixupInfo.bind != nil }.count)
+
+        var visited: [Int] = []
+        chainedFixups.forEachPointer(in: machO) { pointer, stop in
+            visited.append(pointer.offset)
+            stop = visited.count == 10
+        }
+        XCTAssertEqual(visited, Array(expected.map(\.offset).prefix(10)))
+    }
+
+    func testChainedFixUpConcurrentPointers() {
+        guard let chainedFixups = machO.dyldChainedFixups,
+            let startsInImage = chainedFixups.startsInImage else {
+            return
+        }
+        let startsInSegments = chainedFixups.startsInSegments(of: startsInImage)
+        let offsets = startsInSegments
+            .flatMap { chainedFixups.pointers(of: $0, in: machO) }
+            .map(\.offset)
+            .sorted()
+
+        for maxConcurrency in [1, 2, 8] {
+            let pointers = chainedFixups.concurrentPointers(
+                in: machO,
+                maxConcurrency: maxConcurrency
+            )
+            XCTAssertEqual(pointers.map(\.offset), offsets)
+        }
+
+        let binds = chainedFixups.concurrentPointers(in: machO, filter: .bind)
+        XCTAssertTrue(binds.allSatisfy { $0.fixupInfo.bind != nil })
+    }
+
+    func testChainedFixUpIndex() {
+        guard let chainedFixups = machO.dyldChainedFixups,
+            let startsInImage = chainedFixups.startsInImage else {
+            return
+        }
+        let startsInSegments = chainedFixups.startsInSegments(of: startsInImage)
+        for startsInSegment in startsInSegments {
+            let pointers = chainedFixups.pointers(of: startsInSegment, in: machO)
+            guard let index = chainedFixups.fixupIndex(
+                of: startsInSegment,
+                in: machO
+            ) else {
+                XCTAssertTrue(pointers.isEmpty)
+                continue
+            }
+            XCTAssertEqual(index.segmentIndex, startsInSegment.segmentIndex)
+            XCTAssertEqual(index.count, pointers.count)
+
+            let sortedPointers = pointers.sorted { $0.offset < $1.offset }
+            for (position, pointer) in sortedPointers.enumerated() {
+                let indexed = index.pointer(for: UInt64(pointer.offset))
+                XCTAssertEqual(indexed?.offset, pointer.offset)
+                XCTAssertEqual(indexed?.fixupInfo.rebase?.target, pointer.fixupInfo.rebase?.target)
+                XCTAssertEqual(indexed?.fixupInfo.bind?.ordinal, pointer.fixupInfo.bind?.ordinal)
+                XCTAssertEqual(index.pointer(at: position)?.offset, pointer.offset)
+                XCTAssertNil(index.pointer(for: UInt64(pointer.offset + 1)))
+
+                let found = chainedFixups.pointer(
+                    for: UInt64(pointer.offset),
+                    in: machO
+                )
+                XCTAssertEqual(found?.offset, pointer.offset)
+                XCTAssertEqual(found?.fixupInfo.rebase?.target, pointer.fixupInfo.rebase?.target)
+                XCTAssertEqual(found?.fixupInfo.bind?.ordinal, pointer.fixupInfo.bind?.ordinal)
+            }
+        }
+    }
+
+    func testChainedFixUpImportTable() {
+        guard let chainedFixups = machO.dyldChainedFixups,
+            let startsInImage = chainedFixups.startsInImage else {
+            return
+        }
+        let imports = chainedFixups.imports
+        guard let table = machO.dyldChainedImportTable else {
+            XCTFail("No import table")
+            return
+        }
+        XCTAssertEqual(table.count, imports.count)
+
+        for (ordinal, `import`) in imports.enumerated() {
+            let info = `import`.info
+            let entry = table.entry(at: ordinal)
+            XCTAssertEqual(entry?.libraryOrdinal, info.libraryOrdinal)
+            XCTAssertEqual(entry?.addend, info.addend)
+            XCTAssertEqual(entry?.isWeakImport, info.isWeakImport)
+            XCTAssertEqual(
+                table.symbolName(at: ordinal),
+                chainedFixups.symbolName(for: info.nameOffset)
+            )
+        }
+        XCTAssertNil(table.entry(at: imports.count))
+
+        let startsInSegments = chainedFixups.startsInSegments(of: startsInImage)
+        for startsInSegment in startsInSegments {
+            chainedFixups.forEachPointer(
+                of: startsInSegment,
+                in: machO,
+                filter: .bind
+            ) { pointer, _ in
+                guard let (ordinal, addend) = pointer.bindOrdinalAndAddend(for: machO) else {
+                    return
+                }
+                let bind = table.bind(for: pointer)
+                let info = imports[ordinal].info
+                XCTAssertEqual(bind?.ordinal, ordinal)
+                XCTAssertEqual(
+                    bind?.symbolName,
+                    chainedFixups.symbolName(for: info.nameOffset)
+                )
+                XCTAssertEqual(
+                    bind?.addend,
+                    addend &+ UInt64(bitPattern: Int64(info.addend))
+                )
+            }
+        }
+    }
+}
+
+extension MachOFilePrintTests {
+    func testMapImage() throws {
+        guard let imageSize = machO.mappedImageSize,
+              let preferredLoadAddress = machO.loadCommands.text64?.vmaddr
+                ?? machO.loadCommands.text.map({ UInt64($0.vmaddr) }) else {
+            return
+        }
+        let baseAddress: UInt64 = 0x2_0000_0000
+        let symbolAddress: UInt64 = 0x7_0000_0000
+
+        let buffer = UnsafeMutableRawBufferPointer.allocate(
+            byteCount: imageSize,
+            alignment: 0x4000
+        )
+        defer { buffer.deallocate() }
+
+        // Distinct address for each bind target, in order of first resolution
+        var targetAddresses: [FixupBindTarget: UInt64] = [:]
+        try machO.mapImage(into: buffer, baseAddress: baseAddress) { target in
+            if let address = targetAddresses[target] {
+                return address
+            }
+            let address = symbolAddress + UInt64(targetAddresses.count) * 0x1000
+            targetAddresses[target] = address
+            return address
+        }
+
+        func pointerValue(at offset: Int, is64Bit: Bool) -> UInt64 {
+            if is64Bit {
+                return buffer.loadUnaligned(fromByteOffset: offset, as: UInt64.self)
+            }
+            return numericCast(
+                buffer.loadUnaligned(fromByteOffset: offset, as: UInt32.self)
+            )
+        }
+
+        if let chainedFixups = machO.dyldChainedFixups,
+           let importTable = machO.dyldChainedImportTable {
+            var checked = 0
+            chainedFixups.forEachPointer(in: machO) { pointer, stop in
+                let value = pointerValue(
+                    at: pointer.offset,
+                    is64Bit: pointer.fixupInfo.pointerFormat.is64Bit
+                )
+                if let offset = pointer.rebaseTargetRuntimeOffset(for: machO) {
+                    XCTAssertEqual(value, baseAddress &+ offset)
+                } else if let bind = importTable.bind(for: pointer) {
+                    guard let symbolName = bind.symbolName else {
+                        XCTFail("symbol name of import \(bind.ordinal) is not readable")
+                        return
+                    }
+                    let target = FixupBindTarget(
+                        libraryOrdinal: bind.libraryOrdinal,
+                        symbolName: symbolName,
+                        isWeakImport: bind.isWeakImport
+                    )
+                    guard let address = targetAddresses[target] else {
+                        XCTFail("bind target is not resolved: \(symbolName)")
+                        return
+                    }
+                    XCTAssertEqual(value, address &+ bind.addend)
+                } else {
+                    XCTFail("fixup is neither rebase nor bind")
+                }
+                checked += 1
+                stop = checked == 1_000
+            }
+            return
+        }
+
+        // Classic rebases and binds, applied in the same order as `mapImage`
+        let data = try Data(contentsOf: machO.url, options: .alwaysMapped)
+        let segments = machO.segments
+        let slide = baseAddress &- preferredLoadAddress
+        func location(segmentIndex: Int, segmentOffset: UInt) -> Int {
+            segments[segmentIndex].virtualMemoryAddress + Int(segmentOffset) - Int(preferredLoadAddress)
+        }
+
+        var expected: [Int: UInt64] = [:]
+        for rebase in machO.rebases where rebase.type == .pointer {
+            let segment = segments[rebase.segmentIndex]
+            let fileOffset = machO.headerStartOffset + segment.fileOffset + Int(rebase.segmentOffset)
+            let value: UInt64 = data.withUnsafeBytes {
+                if machO.is64Bit {
+                    return $0.loadUnaligned(fromByteOffset: fileOffset, as: UInt64.self)
+                }
+                return numericCast($0.loadUnaligned(fromByteOffset: fileOffset, as: UInt32.self))
+            }
+            expected[location(segmentIndex: rebase.segmentIndex, segmentOffset: rebase.segmentOffset)] = value &+ slide
+        }
+        let bindTables = [
+            (machO.bindingSymbols, false),
+            (machO.lazyBindingSymbols, false),
+            (machO.weakBindingSymbols, true)
+        ]
+        for (bindings, isWeakDefinition) in bindTables {
+            for binding in bindings where binding.type == .pointer {
+                let target = FixupBindTarget(
+                    libraryOrdinal: isWeakDefinition
+                        ? numericCast(BIND_SPECIAL_DYLIB_WEAK_LOOKUP)
+                        : binding.libraryOrdinal,
+                    symbolName: binding.symbolName,
+                    isWeakImport: binding.isWeakImport
+                )
+                guard let address = targetAddresses[target] else {
+                    XCTFail("bind target is not resolved: \(binding.symbolName)")
+                    continue
+                }
+                expected[location(segmentIndex: Int(binding.segmentIndex), segmentOffset: binding.segmentOffset)] =
+                    address &+ UInt64(bitPattern: Int64(binding.addend))
+            }
+        }
+
+        let mask: UInt64 = machO.is64Bit ? .max : 0xFFFF_FFFF
+        for (offset, value) in expected {
+            XCTAssertEqual(
+                pointerValue(at: offset, is64Bit: machO.is64Bit),
+                value & mask
+            )
+        }
+    }
 }
 
 extension MachOFilePrintTests {
@@ -610,6 +610,19 @@ extension MachOPrintTests {
         }
     }
 
+    func testChainedFixUpIndexOfLoadedImage() {
+        guard let chainedFixups = machO.dyldChainedFixups,
+              let startsInImage = chainedFixups.startsInImage else {
+            return
+        }
+        // Chains of an image loaded by dyld are already overwritten
+        let startsInSegments = chainedFixups.startsInSegments(of: startsInImage)
+        for startsInSegment in startsInSegments {
+            XCTAssertNil(chainedFixups.fixupIndex(of: startsInSegment, in: machO))
+        }
+        XCTAssertTrue(chainedFixups.concurrentPointers(in: machO).isEmpty)
+    }
+
     func testChainedFixUpsImports() {
         guard let chainedFixups = machO.dyldChainedFixups else {
             return